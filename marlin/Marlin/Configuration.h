@@ -1009,6 +1009,11 @@
 // and processor overload (too many expensive sqrt calls).
 #define DEFAULT_SEGMENTS_PER_SECOND 200
 
+// Split moves into only as many segments as needed to keep the nozzle within
+// this distance of the straight path. Near the center, where the rods bend the
+// path the least, segments get longer. DEFAULT_SEGMENTS_PER_SECOND stays the limit.
+// #define DELTA_SEGMENT_DEVIATION 0.005 // (mm)
+
 // After homing move down to a height where XY movement is unconstrained
 // #define DELTA_HOME_TO_SAFE_ZONE
 
@@ -1509,7 +1514,10 @@
  */
 // #define BD_SENSOR
 #if ENABLED(BD_SENSOR)
-// #define BD_SENSOR_PROBE_NO_STOP // Probe bed without stopping at each probe point
+// #define BD_SENSOR_PROBE_NO_STOP // Probe bed without stopping at each probe point, sweeping each row of the mesh
+#if ENABLED(BD_SENSOR_PROBE_NO_STOP)
+// #define BD_SENSOR_SWEEP_INTERVAL 2 // (ms) Time between sensor samples during a sweep
+#endif
 #endif
 
 /**
@@ -2186,6 +2194,14 @@
 #define SEGMENT_LEVELED_MOVES
 #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+/**
+ * Precompute a bilinear patch for every mesh cell whenever the mesh changes.
+ * Each Z correction is then a cell lookup and a few multiply-adds, and UBL
+ * segmented moves step from cell to cell instead of re-deriving each cell.
+ * Uses 16 bytes of RAM per mesh cell. Not compatible with ABL_BILINEAR_SUBDIVISION.
+ */
+// #define MESH_CELL_COEFFICIENTS
+
 /**
  * Enable the G26 Mesh Validation Pattern tool.
  */
@@ -2454,6 +2470,7 @@
 #if ENABLED(EEPROM_SETTINGS)
 // #define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
 // #define EEPROM_INIT_NOW   // Init EEPROM on first boot after a new build.
+// #define FLASH_EEPROM_LOG  // With FLASH_EEPROM_EMULATION only append changed settings to the last 2 flash sectors. Quick M500 during a print. (STM32F4)
 #endif
 
 // @section host
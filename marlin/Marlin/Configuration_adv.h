@@ -193,6 +193,21 @@
 // #define MAX31865_WIRE_OHMS_2              0.0f
 // #define MAX31865_WIRE_OHMS_BED            0.0f
 
+/**
+ * Uniform Thermistor Tables
+ * Resample each thermistor table at build time into evenly spaced ADC steps,
+ * so converting a reading is a single lookup and interpolation instead of a
+ * binary search. Uses (SEGMENTS + 1) * 2 bytes of flash per thermistor type.
+ * Helpful with many hotends or sensors and slow PROGMEM reads.
+ * With 1024 segments readings match the searched tables within 0.05°C.
+ * Fewer segments lose accuracy where the curve is steep. With 256 some
+ * tables read several degrees off (over 15°C for type 5 at 300°C).
+ */
+// #define UNIFORM_THERMISTOR_TABLES
+#if ENABLED(UNIFORM_THERMISTOR_TABLES)
+#define UNIFORM_THERMISTOR_SEGMENTS 1024 // Power of 2, 16 to 1024
+#endif
+
 /**
  * Hephestos 2 24V heated bed upgrade kit.
  * https://www.en3dstudios.com/product/bq-hephestos-2-heated-bed-kit/
@@ -1178,6 +1193,11 @@
 #define FTM_STEPPERCMD_BUFF_SIZE 6000
 #endif
 
+// Buffer one step count per axis for each FTM_TS instead of a STEP/DIR mask for every
+// stepper tick. The Stepper ISR spreads the steps over the interval, so the same buffer
+// time takes 1/FTM_STEPS_PER_UNIT_TIME of the RAM and FTM_STEPPER_FS can go to 40-50kHz.
+// #define FTM_PACKED_COMMANDS
+
 #define FTM_STEPS_PER_UNIT_TIME (FTM_STEPPER_FS / FTM_FS)       // Interpolated stepper commands per unit time
 #define FTM_CTS_COMPARE_VAL (FTM_STEPS_PER_UNIT_TIME / 2)       // Comparison value used in interpolation algorithm
 #define FTM_MIN_TICKS ((STEPPER_TIMER_RATE) / (FTM_STEPPER_FS)) // Minimum stepper ticks between steps
@@ -1398,6 +1418,13 @@
  */
 #define MULTISTEPPING_LIMIT 16 //: [1, 2, 4, 8, 16, 32, 64, 128]
 
+/**
+ * Stepper ISR Profiling
+ * Time each phase of the stepper ISR and report min/avg/p99/max and CPU load with M579.
+ * Use it to tune MULTISTEPPING_LIMIT and maximum feedrates. Adds a little time to every ISR.
+ */
+// #define STEPPER_ISR_PROFILE
+
 /**
  * Adaptive Step Smoothing increases the resolution of multi-axis moves, particularly at step frequencies
  * below 1kHz (for AVR) or 10kHz (for ARM), where aliasing between axes in multi-axis moves causes audible
@@ -1739,6 +1766,42 @@
 
 // #define GCODE_REPEAT_MARKERS            // Enable G-code M808 to set repeat markers and do looping
 
+/**
+ * SD Read-Ahead
+ * Buffer whole blocks of the file being printed so the main loop doesn't
+ * wait on the media at every block boundary. Blocks are prefetched during
+ * idle() using multiple-block reads. Use 'M27 R' to report how many waits
+ * were avoided. Uses 512 bytes of SRAM per block.
+ */
+// #define SD_READ_AHEAD
+#if ENABLED(SD_READ_AHEAD)
+#define SD_READ_AHEAD_BLOCKS 2 // Number of blocks to buffer (2 for double-buffering)
+#endif
+
+/**
+ * SD Move Preview
+ * Scan the G0/G1 moves in the read-ahead data before they reach the command
+ * queue. The planner can then end its newest block at a speed the moves that
+ * wait in the command queue can still brake from, instead of a speed to stop
+ * from on its own. Helps prints with many small segments keep their speed.
+ * A bigger BUFSIZE lets it see further ahead. Any other command in the file
+ * ends the preview. Requires SD_READ_AHEAD. Uses 16 bytes of SRAM per move.
+ */
+// #define SD_MOVE_PREVIEW
+#if ENABLED(SD_MOVE_PREVIEW)
+#define SD_PREVIEW_MOVES 16 // Number of lines to scan ahead, including those in the command queue
+#endif
+
+/**
+ * Compressed G-code Files
+ * Print *.gcode.hs files made by buildroot/share/scripts/gcode_heatshrink.py,
+ * decompressing them as they are read. G-code shrinks to about a third, so
+ * less data is read from the media and uploaded. The file is compressed in
+ * blocks with an index, so M26, M808, and Power-Loss Recovery can still seek.
+ * Compressed files don't use SD_READ_AHEAD or SD_MOVE_PREVIEW. Uses 350 bytes of SRAM.
+ */
+// #define SD_HEATSHRINK
+
 #define SD_PROCEDURE_DEPTH 1 // Increase if you need more nested M32 calls
 
 #define SD_FINISHED_STEPPERRELEASE true  // Disable steppers when SD Print is finished
@@ -1938,6 +2001,8 @@
 #if ENABLED(BINARY_FILE_TRANSFER)
 // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
 // #define CUSTOM_FIRMWARE_UPLOAD
+#define BINARY_STREAM_WRITE_BLOCKS 1 // (512 byte blocks) Received data to buffer for each pre-erased multi-block write.
+                                     // Each block takes 512 bytes of RAM. Try 4 on 32-bit boards. AVR is limited to 1.
 #endif
 
 // "Over-the-air" Firmware Update with M936 - Required to set EEPROM flag
@@ -2560,6 +2625,7 @@
 #define N_ARC_CORRECTION 25 // Number of interpolated segments between corrections
 // #define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles
 // #define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
+// #define ARC_NATIVE_BLOCKS         // With FT_MOTION, queue each arc as one curved block instead of segments
 #endif
 
 // G5 Bézier Curve Support with XYZE destination and IJPQ offsets
@@ -2567,6 +2633,7 @@
 
 #if ANY(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
 // #define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
+// #define CURVE_MAX_DEVIATION 0.005 // (mm) Size G2/G3/G5 segments by curvature, keeping chords this close to the curve
 #endif
 
 /**
@@ -2653,6 +2720,7 @@
 // @section gcode
 
 // The number of linear moves that can be in the planner at once.
+// Up to 256 on 32-bit boards. Many short segments at high speed need a longer buffer to reach full speed.
 #if ALL(HAS_MEDIA, DIRECT_STEPPING)
 #define BLOCK_BUFFER_SIZE 8
 #elif HAS_MEDIA
@@ -2665,7 +2733,16 @@
 
 // The ASCII buffer for serial input
 #define MAX_CMD_SIZE 96
-#define BUFSIZE 4
+#define BUFSIZE 4     // Commands in the queue, up to 255
+
+/**
+ * Share the command queue among the serial ports (SERIAL_PORT_2, SERIAL_PORT_3).
+ * Each port keeps room for QUEUE_PORT_RESERVE commands and the rest of BUFSIZE
+ * goes to whichever port fills it. So a host polling M105 on one port can't push
+ * out the moves streamed by a host on another port. Increase BUFSIZE to give the
+ * ports more room to share. With ADVANCED_OK, "B" is the room left for the port.
+ */
+// #define QUEUE_PORT_RESERVE 2
 
 /**
  * Host Transmit Buffer Size
@@ -3402,6 +3479,7 @@
  * for error conditions like overtemperature and short to ground.
  * To manage over-temp Marlin can decrease the driver current until the error condition clears.
  * Other detected conditions can be used to stop the current print.
+ * Drivers are polled one register per idle loop, so a chain of UART drivers won't stall the loop.
  * Relevant G-codes:
  * M906 - Set or get motor current in milliamps using axis codes X, Y, Z, E. Report values if no axis codes given.
  * M911 - Report stepper driver overtemperature pre-warn condition.
@@ -3777,6 +3855,19 @@
  */
 // #define LASER_POWER_TRAP
 
+/**
+ * Raster engraving with G7. Each G7 is a straight move with a base64-encoded
+ * line of 8-bit pixels that scale the S power as the laser crosses them.
+ * The pixels are buffered with the planner so rows can be sent back-to-back.
+ * Requires inline mode (M3 I). Not compatible with LASER_POWER_TRAP, FT_MOTION,
+ * or DELTA, SCARA, and POLAR kinematics.
+ */
+// #define LASER_RASTER
+#if ENABLED(LASER_RASTER)
+  #define LASER_RASTER_PIXELS   32  // Most pixels in one G7. Each 3 pixels take 4 characters of MAX_CMD_SIZE.
+  #define LASER_RASTER_BUFFERS   8  // G7 moves buffered at once. One is always free to fill.
+#endif
+
 //
 // Laser I2C Ammeter (High precision INA226 low/high side module)
 //
@@ -3992,6 +4083,17 @@
 // #define AUTO_REPORT_REAL_POSITION // Auto-report the real position
 #endif
 
+/**
+ * Record temperatures, heater power, planner use, stepper positions and fan
+ * speeds at a fixed rate, and send them to the host as binary frames with
+ * M582 or every M582 S<seconds>. Samples that aren't sent in time are lost.
+ */
+// #define TELEMETRY_RECORDER
+#if ENABLED(TELEMETRY_RECORDER)
+  #define TELEMETRY_INTERVAL  50 // (ms) Time between samples. The samples may use at most half of BAUDRATE.
+  #define TELEMETRY_SAMPLES   40 // Samples kept for the host, up to 255. Cover the report interval.
+#endif
+
 /**
  * M115 - Report capabilites. Disable to save ~1150 bytes of flash.
  *        Some hosts (and serial TFT displays) rely on this feature.
@@ -4030,6 +4132,13 @@
 // #define MEATPACK_ON_SERIAL_PORT_1
 // #define MEATPACK_ON_SERIAL_PORT_2
 
+/**
+ * Binary G-code for G0-G3, G92, and M204. Moves are sent as framed binary
+ * values with a CRC, skipping line assembly and number parsing.
+ * ASCII commands still work. See buildroot/share/scripts/MarlinBinaryGcode.py
+ */
+// #define BINARY_GCODE
+
 // #define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 // #define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -4225,6 +4334,7 @@
 // #define CANCEL_OBJECTS
 #if ENABLED(CANCEL_OBJECTS)
 #define CANCEL_OBJECTS_REPORTING // Emit the current object as a status message
+#define CANCEL_OBJECTS_MAX 32     // (1..127) Objects that can be canceled. Costs 1 byte of RAM per 8 objects.
 #endif
 
 /**
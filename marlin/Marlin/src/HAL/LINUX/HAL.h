@@ -36,6 +36,9 @@
 #include <algorithm>
 
 #include "hardware/Clock.h"
+#ifdef LINUX_BENCHMARK
+  #include "hardware/Benchmark.h"
+#endif
 #include "../shared/Marduino.h"
 #include "../shared/math_32bit.h"
 #include "../shared/HAL_SPI.h"
@@ -127,7 +130,7 @@ public:
   static void delay_ms(const int ms) { delay(ms); }
 
   // Tasks, called from idle()
-  static void idletask() {}
+  static void idletask() { Clock::poll(); }
 
   // Reset
   static constexpr uint8_t reset_reason = RST_POWER_ON;
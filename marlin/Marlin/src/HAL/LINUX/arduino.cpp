@@ -32,6 +32,7 @@ void sei() { } // Enable
 
 // Time functions
 unsigned long millis() {
+  Clock::poll();
   return (unsigned long)Clock::millis();
 }
 
@@ -49,6 +50,10 @@ extern "C" void delay(const int msec) {
 void pinMode(const pin_t pin, const uint8_t mode) {
   if (!isValidPin(pin)) return;
   Gpio::setMode(pin, mode);
+  #ifdef LINUX_VIRTUAL_TIME
+    // Nothing drives unconnected inputs headless, so let the pull-up win
+    if (mode == INPUT_PULLUP) Gpio::set(pin, HIGH);
+  #endif
 }
 
 void digitalWrite(pin_t pin, uint8_t pin_status) {
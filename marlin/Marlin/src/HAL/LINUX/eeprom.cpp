@@ -40,7 +40,11 @@ size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE - eeprom_exclude_
 bool PersistentStore::access_start() {
   const char eeprom_erase_value = 0xFF;
   FILE * eeprom_file = fopen(filename, "rb");
-  if (!eeprom_file) return false;
+  if (!eeprom_file) {
+    // No file yet, so present a freshly erased EEPROM
+    memset(buffer, eeprom_erase_value, MARLIN_EEPROM_SIZE);
+    return true;
+  }
 
   fseek(eeprom_file, 0L, SEEK_END);
   std::size_t file_size = ftell(eeprom_file);
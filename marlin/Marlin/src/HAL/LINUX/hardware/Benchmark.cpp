@@ -0,0 +1,118 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+#ifdef LINUX_BENCHMARK
+
+#include "Benchmark.h"
+#include "Clock.h"
+
+#include <stdio.h>
+#include <chrono>
+
+uint64_t Benchmark::self_ns[STAGE_COUNT], Benchmark::calls[STAGE_COUNT],
+         Benchmark::mark = Benchmark::host_nanos(), Benchmark::host_start = Benchmark::mark;
+Benchmark::Stage Benchmark::current = OTHER;
+
+uint32_t Benchmark::blocks, Benchmark::dry_count;
+uint64_t Benchmark::dry_start, Benchmark::dry_total, Benchmark::dry_longest;
+bool Benchmark::moving, Benchmark::dry;
+Benchmark::DryGap Benchmark::dry_log[DRY_LOG_SIZE];
+
+static const char * const stage_name[Benchmark::STAGE_COUNT] = {
+  "other", "queue", "command", "parse", "plan", "block_phase", "pulse_phase", "idle"
+};
+
+uint64_t Benchmark::host_nanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Benchmark::charge(const uint64_t now) {
+  self_ns[current] += now - mark;
+  mark = now;
+}
+
+Benchmark::Stage Benchmark::enter(const Stage stage) {
+  charge(host_nanos());
+  calls[stage]++;
+  const Stage outer = current;
+  current = stage;
+  return outer;
+}
+
+void Benchmark::leave(const Stage outer) {
+  charge(host_nanos());
+  current = outer;
+}
+
+void Benchmark::block_fetched(const bool found) {
+  const uint64_t now = Clock::nanos();
+  if (found) {
+    blocks++;
+    if (dry) {
+      // The buffer ran dry between two blocks
+      const uint64_t length = now - dry_start;
+      if (dry_count < DRY_LOG_SIZE) dry_log[dry_count] = { dry_start, length };
+      dry_count++;
+      dry_total += length;
+      if (length > dry_longest) dry_longest = length;
+      dry = false;
+    }
+    moving = true;
+  }
+  else if (moving) {
+    // Ran out of blocks. Only counts if more blocks follow.
+    moving = false;
+    dry = true;
+    dry_start = now;
+  }
+}
+
+void Benchmark::report() {
+  charge(host_nanos());
+
+  const double host_s = (mark - host_start) * 1e-9,
+               virtual_s = Clock::seconds();
+
+  printf("Benchmark: %u blocks, %llu commands in %.3f s host, %.6f s virtual\n",
+    blocks, (unsigned long long)calls[COMMAND], host_s, virtual_s);
+  printf("Benchmark: %.1f blocks/s host, %.1f blocks/s virtual\n",
+    host_s > 0 ? blocks / host_s : 0, virtual_s > 0 ? blocks / virtual_s : 0);
+
+  printf("%-12s %12s %12s %10s %7s\n", "stage", "calls", "self ms", "ns/call", "share");
+  for (uint8_t s = 0; s < STAGE_COUNT; ++s)
+    printf("%-12s %12llu %12.3f %10.0f %6.1f%%\n", stage_name[s],
+      (unsigned long long)calls[s], self_ns[s] * 1e-6,
+      calls[s] ? double(self_ns[s]) / calls[s] : 0,
+      host_s > 0 ? self_ns[s] * 1e-7 / host_s : 0
+    );
+
+  printf("Benchmark: planner ran dry %u times, %.6f s total, longest %.6f s\n",
+    dry_count, dry_total * 1e-9, dry_longest * 1e-9);
+  for (uint8_t i = 0; i < dry_count && i < DRY_LOG_SIZE; ++i)
+    printf("  at %.6f s for %.6f s\n", dry_log[i].start * 1e-9, dry_log[i].length * 1e-9);
+  if (dry_count > DRY_LOG_SIZE) printf("  ... %u more\n", dry_count - DRY_LOG_SIZE);
+
+  fflush(stdout);
+}
+
+#endif // LINUX_BENCHMARK
+#endif // __PLAT_LINUX__
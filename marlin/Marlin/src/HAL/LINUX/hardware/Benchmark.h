@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Pipeline benchmark for the virtual-time simulator (LINUX_BENCHMARK)
+ *
+ * Probes placed in the queue, parser, planner and stepper measure the host
+ * time spent in each stage. Time is charged to the innermost probe only,
+ * so a planner wait that runs the stepper ISR is not counted twice.
+ * Gaps where the stepper had no block to run are recorded in virtual time.
+ */
+
+#include <stdint.h>
+
+class Benchmark {
+public:
+  enum Stage : uint8_t { OTHER, QUEUE, COMMAND, PARSE, PLAN, BLOCK_PHASE, PULSE_PHASE, IDLE, STAGE_COUNT };
+
+  class Probe {
+  public:
+    Probe(const Stage stage) : outer(Benchmark::enter(stage)) {}
+    ~Probe() { Benchmark::leave(outer); }
+  private:
+    const Stage outer;
+  };
+
+  static Stage enter(const Stage stage);
+  static void leave(const Stage outer);
+
+  // Called by the stepper each time it looks for a new block
+  static void block_fetched(const bool found);
+
+  static void report();
+
+private:
+  static constexpr uint8_t DRY_LOG_SIZE = 16;
+
+  struct DryGap { uint64_t start, length; };
+
+  static uint64_t self_ns[STAGE_COUNT], calls[STAGE_COUNT], mark, host_start;
+  static Stage current;
+
+  static uint32_t blocks, dry_count;
+  static uint64_t dry_start, dry_total, dry_longest;
+  static bool moving, dry;
+  static DryGap dry_log[DRY_LOG_SIZE];
+
+  static uint64_t host_nanos();
+  static void charge(const uint64_t now);
+};
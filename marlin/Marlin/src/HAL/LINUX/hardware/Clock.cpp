@@ -24,7 +24,11 @@
 #include "../../../inc/MarlinConfig.h"
 #include "Clock.h"
 
-std::chrono::nanoseconds Clock::startup = std::chrono::high_resolution_clock::now().time_since_epoch();
+#ifdef LINUX_VIRTUAL_TIME
+  std::chrono::nanoseconds Clock::startup = std::chrono::nanoseconds(0);
+#else
+  std::chrono::nanoseconds Clock::startup = std::chrono::high_resolution_clock::now().time_since_epoch();
+#endif
 uint32_t Clock::frequency = F_CPU;
 double Clock::time_multiplier = 1.0;
 
@@ -24,6 +24,15 @@
 #include <chrono>
 #include <thread>
 
+#ifdef LINUX_VIRTUAL_TIME
+  #include "EventQueue.h"
+
+  // Virtual time charged for each poll of the clock from the main loop
+  #ifndef LINUX_VIRTUAL_POLL_NS
+    #define LINUX_VIRTUAL_POLL_NS 1000
+  #endif
+#endif
+
 class Clock {
 public:
   static uint64_t ticks(uint32_t frequency = Clock::frequency) {
@@ -43,12 +52,30 @@ public:
     Clock::frequency = freq;
   }
 
+#ifdef LINUX_VIRTUAL_TIME
+
+  // Virtual time only moves when the firmware waits or polls the clock
+  static uint64_t nanos() {
+    return EventQueue::now();
+  }
+
+  // Called by the main loop and millis() so busy-waits can make progress
+  static void poll() {
+    EventQueue::advance(LINUX_VIRTUAL_POLL_NS);
+  }
+
+#else
+
   // Time Acceleration compensated
   static uint64_t nanos() {
     auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
     return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
   }
 
+  static void poll() {}
+
+#endif
+
   static uint64_t micros() {
     return Clock::nanos() / 1000;
   }
@@ -61,6 +88,26 @@ public:
     return Clock::nanos() / 1000000000.0;
   }
 
+#ifdef LINUX_VIRTUAL_TIME
+
+  static void delayCycles(uint64_t cycles) {
+    EventQueue::advance((1000000000ULL / frequency) * cycles);
+  }
+
+  static void delayMicros(uint64_t micros) {
+    EventQueue::advance(micros * 1000ULL);
+  }
+
+  static void delayMillis(uint64_t millis) {
+    EventQueue::advance(millis * 1000000ULL);
+  }
+
+  static void delaySeconds(double secs) {
+    EventQueue::advance(uint64_t(secs * 1000000000.0));
+  }
+
+#else
+
   static void delayCycles(uint64_t cycles) {
     std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
   }
@@ -77,6 +124,8 @@ public:
     std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
   }
 
+#endif
+
   // Will reduce timer resolution increasing likelihood of overflows
   static void setTimeMultiplier(double tm) {
     Clock::time_multiplier = tm;
@@ -0,0 +1,53 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+#ifdef LINUX_VIRTUAL_TIME
+
+#include "EventQueue.h"
+
+std::priority_queue<EventQueue::Event, std::vector<EventQueue::Event>, std::greater<EventQueue::Event>> EventQueue::events;
+uint64_t EventQueue::current = 0, EventQueue::sequence = 0;
+bool EventQueue::in_event = false;
+
+void EventQueue::schedule(const uint64_t timestamp, callback_fn fn) {
+  events.push({ timestamp, sequence++, fn });
+}
+
+void EventQueue::advance(const uint64_t nanos) {
+  const uint64_t until = current + nanos;
+
+  if (!in_event) {
+    in_event = true;
+    while (!events.empty() && events.top().timestamp <= until) {
+      const Event ev = events.top();
+      events.pop();
+      if (ev.timestamp > current) current = ev.timestamp;
+      ev.fn();
+    }
+    in_event = false;
+  }
+
+  if (until > current) current = until;
+}
+
+#endif // LINUX_VIRTUAL_TIME
+#endif // __PLAT_LINUX__
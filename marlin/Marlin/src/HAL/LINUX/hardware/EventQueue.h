@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Discrete-event scheduler for the virtual clock (LINUX_VIRTUAL_TIME)
+ *
+ * Timers and simulated peripherals post events at a virtual timestamp.
+ * Advancing the clock runs every event that falls due, in timestamp order,
+ * with ties broken by the order they were posted. Nothing depends on the
+ * wall clock, so the same input always produces the same run.
+ */
+
+#include <stdint.h>
+#include <functional>
+#include <queue>
+#include <vector>
+
+class EventQueue {
+public:
+  typedef std::function<void()> callback_fn;
+
+  // Current virtual time in nanoseconds
+  static uint64_t now() { return current; }
+
+  // Post an event to run at a virtual time (in the past means "as soon as possible")
+  static void schedule(const uint64_t timestamp, callback_fn fn);
+
+  // Move virtual time forward, running all events due up to the new time.
+  // Inside an event (i.e., an ISR) time moves forward but nothing else runs.
+  static void advance(const uint64_t nanos);
+
+  static bool dispatching() { return in_event; }
+  static bool empty() { return events.empty(); }
+
+private:
+  struct Event {
+    uint64_t timestamp, sequence;
+    callback_fn fn;
+    bool operator>(const Event &rhs) const {
+      return timestamp != rhs.timestamp ? timestamp > rhs.timestamp : sequence > rhs.sequence;
+    }
+  };
+
+  static std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+  static uint64_t current, sequence;
+  static bool in_event;
+};
@@ -43,7 +43,7 @@ void Heater::update() {
   // crude pwm read and cruder heat simulation
   auto now = Clock::micros();
   double delta = (now - last);
-  if (delta > 1000 ) {
+  if (delta >= 1000) {
     heater_state = pwmcap.update(0xFFFF * Gpio::pin_map[heater_pin].value);
     last = now;
     heat += (heater_state - heat) * (delta / 1000000000.0);
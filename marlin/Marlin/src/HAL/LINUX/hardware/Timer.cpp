@@ -34,6 +34,10 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  #ifdef LINUX_VIRTUAL_TIME
+    generation = 0;
+    pending = false;
+  #endif
 }
 
 Timer::~Timer() {
@@ -43,6 +47,64 @@ Timer::~Timer() {
   }
 }
 
+#ifdef LINUX_VIRTUAL_TIME
+
+/**
+ * Virtual time: each compare match is an event on the EventQueue.
+ * The count restarts at every match, like a hardware timer in
+ * compare-and-reset mode, so a new compare set inside the ISR is
+ * measured from the start of that ISR.
+ */
+
+void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
+  frequency = sim_freq;
+  cbfn = fn;
+  disable();
+}
+
+void Timer::start(uint32_t frequency) {
+  setCompare(this->frequency / frequency);
+}
+
+void Timer::enable() {
+  active = true;
+  if (pending) {
+    pending = false;
+    schedule(Clock::nanos());
+  }
+}
+
+void Timer::disable() {
+  active = false;
+}
+
+void Timer::schedule(uint64_t timestamp) {
+  const uint32_t gen = generation;
+  EventQueue::schedule(timestamp, [this, gen]{ fire(gen); });
+}
+
+void Timer::setCompare(uint32_t compare) {
+  this->compare = compare;
+  period = Clock::ticksToNanos(compare, frequency);
+  if (!period) period = 1;                // Always let time move forward
+  generation++;
+  schedule(start_time + period);
+}
+
+void Timer::fire(uint32_t gen) {
+  if (gen != generation) return;          // Compare was changed after this was posted
+  if (!active) { pending = true; return; }
+  start_time = Clock::nanos();
+  schedule(start_time + period);          // Periodic unless the ISR sets a new compare
+  cbfn();
+}
+
+uint32_t Timer::getCount() {
+  return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
+}
+
+#else // !LINUX_VIRTUAL_TIME
+
 void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
   struct sigaction sa;
   struct sigevent sev;
@@ -117,4 +179,6 @@ uint32_t Timer::getCount() {
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
+#endif // !LINUX_VIRTUAL_TIME
+
 #endif // __PLAT_LINUX__
@@ -52,6 +52,11 @@ public:
     return (*(intptr_t*)timerid);
   }
 
+#ifdef LINUX_VIRTUAL_TIME
+  // Match event posted to the EventQueue for a given compare setting
+  void fire(uint32_t gen);
+#endif
+
   static void handler(int sig, siginfo_t *si, void *uc) {
     Timer* _this = (Timer*)si->si_value.sival_ptr;
     _this->avg_error += (Clock::nanos() - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
@@ -73,4 +78,9 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+#ifdef LINUX_VIRTUAL_TIME
+  uint32_t generation;  // Bumped on each setCompare to drop stale events
+  bool pending;         // Matched while disabled, so run on enable()
+  void schedule(uint64_t timestamp);
+#endif
 };
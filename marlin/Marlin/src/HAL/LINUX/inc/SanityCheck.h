@@ -42,6 +42,10 @@
   #error "TMC220x Software Serial is not supported for HAL/LINUX."
 #endif
 
+#if defined(LINUX_BENCHMARK) && !defined(LINUX_VIRTUAL_TIME)
+  #error "LINUX_BENCHMARK requires LINUX_VIRTUAL_TIME."
+#endif
+
 #if ENABLED(POSTMORTEM_DEBUGGING)
   #error "POSTMORTEM_DEBUGGING is not yet supported for HAL/LINUX."
 #endif
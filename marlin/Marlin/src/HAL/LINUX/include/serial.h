@@ -29,49 +29,85 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <atomic>
+#include <unistd.h>
+#include <sys/eventfd.h>
 
 /**
- * Generic RingBuffer
+ * Lock-free single-producer, single-consumer ring buffer.
  * T type of the buffer array
  * S size of the buffer (must be power of 2)
+ * Only the producer moves index_write and only the consumer moves index_read.
  */
 template <typename T, uint32_t S> class RingBuffer {
 public:
-  RingBuffer() { index_read = index_write = 0; }
-  uint32_t available() volatile { return index_write - index_read; }
-  uint32_t free() volatile      { return buffer_size - available(); }
-  bool empty() volatile         { return index_read == index_write; }
-  bool full() volatile          { return available() == buffer_size; }
-  void clear() volatile         { index_read = index_write = 0; }
-
-  bool peek(T *value) volatile {
-    if (value == 0 || available() == 0)
-      return false;
-    *value = buffer[mask(index_read)];
+  RingBuffer() : index_write(0), index_read(0) {}
+  uint32_t available() const { return index_write.load() - index_read.load(); }
+  uint32_t free() const      { return buffer_size - available(); }
+  bool empty() const         { return available() == 0; }
+  bool full() const          { return available() == buffer_size; }
+  void clear()               { index_read.store(index_write.load()); } // Consumer side
+
+  bool peek(T *value) const {
+    if (value == 0 || empty()) return false;
+    *value = buffer[mask(index_read.load(std::memory_order_relaxed))];
     return true;
   }
 
-  int read() volatile {
+  int read() {
     if (empty()) return -1;
-    return buffer[mask(index_read++)];
+    const uint32_t r = index_read.load(std::memory_order_relaxed);
+    const T value = buffer[mask(r)];
+    index_read.store(r + 1);
+    return value;
   }
 
-  bool write(T value) volatile {
+  bool write(T value) {
     if (full()) return false;
-    buffer[mask(index_write++)] = value;
+    const uint32_t w = index_write.load(std::memory_order_relaxed);
+    buffer[mask(w)] = value;
+    index_write.store(w + 1);
     return true;
   }
 
 private:
-  uint32_t mask(uint32_t val) volatile {
-    return buffer_mask & val;
-  }
+  static uint32_t mask(uint32_t val) { return buffer_mask & val; }
 
   static const uint32_t buffer_size = S;
   static const uint32_t buffer_mask = buffer_size - 1;
-  volatile T buffer[buffer_size];
-  volatile uint32_t index_write;
-  volatile uint32_t index_read;
+  T buffer[buffer_size];
+  std::atomic<uint32_t> index_write, index_read;
+};
+
+/**
+ * Lets one side of a RingBuffer sleep until the other side makes progress.
+ * The sleeper flags itself before its final check, so a notify() is only
+ * a system call when someone is actually waiting.
+ */
+class RingWaiter {
+public:
+  RingWaiter() : fd(eventfd(0, EFD_CLOEXEC)), waiting(false) {}
+
+  template <typename F>
+  void wait_until(F ready) {
+    while (!ready()) {
+      waiting.store(true);
+      if (ready()) { waiting.store(false); break; }
+      uint64_t count;
+      if (::read(fd, &count, sizeof(count)) < 0) break;
+    }
+  }
+
+  void notify() {
+    if (waiting.exchange(false)) {
+      const uint64_t one = 1;
+      if (::write(fd, &one, sizeof(one)) < 0) { /* nada */ }
+    }
+  }
+
+private:
+  const int fd;
+  std::atomic<bool> waiting;
 };
 
 struct HalSerial {
@@ -85,12 +121,22 @@ struct HalSerial {
     return receive_buffer.peek(&value) ? value : -1;
   }
 
-  int read() { return receive_buffer.read(); }
+  int read() {
+    const int c = receive_buffer.read();
+    rx_space.notify();
+    return c;
+  }
 
   size_t write(char c) {
     if (!host_connected) return 0;
-    while (!transmit_buffer.free());
-    return transmit_buffer.write(c);
+    #ifdef LINUX_VIRTUAL_TIME
+      return fputc(c, stdout) == EOF ? 0 : 1; // No output thread with a virtual clock
+    #else
+      tx_space.wait_until([this]{ return !transmit_buffer.full(); });
+      const bool ok = transmit_buffer.write(c);
+      tx_data.notify();
+      return ok;
+    #endif
   }
 
   bool connected() { return host_connected; }
@@ -99,19 +145,26 @@ struct HalSerial {
     return (uint16_t)receive_buffer.available();
   }
 
-  void flush() { receive_buffer.clear(); }
+  void flush() { receive_buffer.clear(); rx_space.notify(); }
 
   uint8_t availableForWrite() {
     return transmit_buffer.free() > 255 ? 255 : (uint8_t)transmit_buffer.free();
   }
 
   void flushTX() {
-    if (host_connected)
-      while (transmit_buffer.available()) { /* nada */ }
+    #ifdef LINUX_VIRTUAL_TIME
+      fflush(stdout);
+    #else
+      if (host_connected)
+        tx_space.wait_until([this]{ return transmit_buffer.empty(); });
+    #endif
   }
 
-  volatile RingBuffer<uint8_t, 128> receive_buffer;
-  volatile RingBuffer<uint8_t, 128> transmit_buffer;
+  RingBuffer<uint8_t, 128> receive_buffer;
+  RingBuffer<uint8_t, 128> transmit_buffer;
+  RingWaiter rx_space,  // Reader thread waits for room in receive_buffer
+             tx_data,   // Writer thread waits for data in transmit_buffer
+             tx_space;  // Firmware waits for room in transmit_buffer
   volatile bool host_connected;
 };
 
@@ -31,8 +31,16 @@
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
 
+#ifdef LINUX_VIRTUAL_TIME
+  #include "../../gcode/queue.h"
+  #include "../../module/planner.h"
+#endif
+
 #include <stdio.h>
 #include <stdarg.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <termios.h>
 #include <thread>
 #include <iostream>
 #include <fstream>
@@ -40,24 +48,148 @@
 extern void setup();
 extern void loop();
 
-// simple stdout / stdin implementation for fake serial port
+#ifdef LINUX_VIRTUAL_TIME
+
+/**
+ * Virtual time: everything runs on the main thread, in an order set only
+ * by the EventQueue, so a given input file always gives the same output.
+ * Input is read only when the firmware is out of commands, and the run
+ * ends once the input is exhausted and all motion has finished.
+ */
+void virtual_serial_task() {
+  static bool input_done = false;
+
+  if (!input_done) {
+    if (!usb_serial.receive_buffer.empty() || queue.has_commands_queued()) return;
+    fflush(stdout);
+    // Raw bytes, so binary G-code frames pass through intact
+    char buffer[128];
+    const size_t count = fread(buffer, 1, _MIN(usb_serial.receive_buffer.free(), uint32_t(sizeof(buffer))), stdin);
+    if (count) {
+      for (std::size_t i = 0; i < count; i++)
+        usb_serial.receive_buffer.write(buffer[i]);
+      return;
+    }
+    input_done = true;
+  }
+
+  if (usb_serial.receive_buffer.empty() && !queue.has_commands_queued() && !planner.has_blocks_queued()) {
+    printf("Virtual time: %.6f s\n", Clock::seconds());
+    #ifdef LINUX_BENCHMARK
+      Benchmark::report();
+    #endif
+    fflush(stdout);
+    exit(0);
+  }
+}
+
+// Run a peripheral's update() at a fixed virtual interval
+void schedule_updates(Peripheral &p, const uint64_t interval_ns) {
+  EventQueue::schedule(Clock::nanos() + interval_ns, [&p, interval_ns]{
+    p.update();
+    schedule_updates(p, interval_ns);
+  });
+}
+
+int main() {
+  #ifdef MYSERIAL1
+    MYSERIAL1.begin(BAUDRATE);
+    SERIAL_ECHOLNPGM("x86_64 Initialized (virtual time)");
+    SERIAL_FLUSHTX();
+  #endif
+
+  Clock::setFrequency(F_CPU);
+
+  static Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
+  static Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
+  static LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
+  static LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
+  static LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
+  static LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+
+  #ifdef GPIO_LOGGING
+    static IOLoggerCSV logger("all_gpio_log.csv");
+    Gpio::attachLogger(&logger);
+  #endif
+
+  schedule_updates(hotend, 1000000UL);
+  schedule_updates(bed, 1000000UL);
+  schedule_updates(x_axis, 1000000UL);
+  schedule_updates(y_axis, 1000000UL);
+  schedule_updates(z_axis, 1000000UL);
+  schedule_updates(extruder0, 1000000UL);
+
+  HAL_timer_init();
+
+  DELAY_US(10000);
+
+  setup();
+  for (;;) {
+    loop();
+    virtual_serial_task();
+    Clock::poll();
+    #ifdef GPIO_LOGGING
+      logger.flush();
+    #endif
+  }
+}
+
+#else // !LINUX_VIRTUAL_TIME
+
+/**
+ * The serial port is stdin / stdout, or a pseudo-terminal given by --pty
+ * so hosts like OctoPrint can connect to it as a real serial device.
+ * Both threads sleep until there is work, so an idle port costs no CPU.
+ */
+static int serial_in = STDIN_FILENO, serial_out = STDOUT_FILENO;
+
+static bool open_pty(const char * const link) {
+  const int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) || unlockpt(master)) return false;
+  const char * const name = ptsname(master);
+
+  // Keep the slave side open so reads block (instead of failing) while no host is connected
+  const int slave = open(name, O_RDWR | O_NOCTTY);
+  if (slave < 0) return false;
+  termios tio;
+  tcgetattr(slave, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(slave, TCSANOW, &tio);
+
+  if (link) {
+    unlink(link);
+    if (symlink(name, link)) perror(link);
+  }
+  fprintf(stderr, "Serial port: %s\n", link ? link : name);
+  serial_in = serial_out = master;
+  return true;
+}
+
 void write_serial_thread() {
+  uint8_t buffer[128];
   for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
+    usb_serial.tx_data.wait_until([]{ return !usb_serial.transmit_buffer.empty(); });
+    std::size_t count = 0;
+    for (int c; count < sizeof(buffer) && (c = usb_serial.transmit_buffer.read()) >= 0;)
+      buffer[count++] = c;
+    usb_serial.tx_space.notify();
+    for (std::size_t i = 0; i < count;) {
+      const ssize_t n = write(serial_out, buffer + i, count - i);
+      if (n > 0) i += n; else if (errno != EINTR) break;
     }
-    std::this_thread::yield();
   }
 }
 
 void read_serial_thread() {
-  char buffer[255] = {};
+  uint8_t buffer[128];
   for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
-    std::this_thread::yield();
+    usb_serial.rx_space.wait_until([]{ return !usb_serial.receive_buffer.full(); });
+    // Raw bytes, so binary protocols pass through intact
+    const ssize_t count = read(serial_in, buffer, _MIN(usb_serial.receive_buffer.free(), sizeof(buffer)));
+    if (count > 0)
+      for (ssize_t i = 0; i < count; i++) usb_serial.receive_buffer.write(buffer[i]);
+    else if (count == 0 || errno != EINTR)
+      return; // End of input
   }
 }
 
@@ -106,7 +238,17 @@ void simulation_loop() {
   }
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "--pty", 5) && (!argv[i][5] || argv[i][5] == '=')) {
+      if (!open_pty(argv[i][5] ? argv[i] + 6 : nullptr)) { perror("--pty"); return 1; }
+    }
+    else {
+      fprintf(stderr, "Usage: %s [--pty[=LINK]]\n", argv[0]);
+      return 1;
+    }
+  }
+
   std::thread write_serial (write_serial_thread);
   std::thread read_serial (read_serial_thread);
 
@@ -136,5 +278,7 @@ int main() {
   read_serial.join();
 }
 
+#endif // !LINUX_VIRTUAL_TIME
+
 #endif // UNIT_TEST
 #endif // __PLAT_LINUX__
@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(FLASH_EEPROM_LOG)
+
+#include "../../shared/eeprom_log.h"
+
+#include <stm32_def.h>
+
+/**
+ * Flash access for the settings log (HAL/shared/eeprom_log.cpp).
+ * Each bank is one of the sectors ending with FLASH_SECTOR, which must
+ * all be FLASH_UNIT_SIZE in size, as on the upper sectors of the STM32F4.
+ */
+
+#define FLASH_LOG_FIRST_SECTOR  ((FLASH_SECTOR) - (FLASH_LOG_BANKS) + 1)
+#define FLASH_LOG_ADDRESS_START (FLASH_END - ((FLASH_SECTOR_TOTAL - (FLASH_LOG_FIRST_SECTOR)) * (FLASH_UNIT_SIZE)) + 1)
+
+#define FLASH_FLAGS_TO_CLEAR    (FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR)
+
+static_assert(IS_FLASH_SECTOR(FLASH_LOG_FIRST_SECTOR) && IS_FLASH_SECTOR(FLASH_SECTOR), "FLASH_SECTOR and FLASH_LOG_BANKS don't fit the flash sectors.");
+static_assert(IS_POWER_OF_2(FLASH_UNIT_SIZE), "FLASH_UNIT_SIZE should be a power of 2, please check your chip's spec sheet");
+
+const uint8_t* flash_log_bank(const uint8_t bank) {
+  return (const uint8_t *)(FLASH_LOG_ADDRESS_START + bank * (FLASH_UNIT_SIZE));
+}
+
+// Linker symbols for the end of the firmware image
+extern "C" uint32_t _sidata, _sdata, _edata;
+
+bool flash_log_erase(const uint8_t bank) {
+  // Never erase a sector that holds part of the firmware
+  const uint32_t firmware_end = uint32_t(&_sidata) + (uint32_t(&_edata) - uint32_t(&_sdata));
+  if (uint32_t(flash_log_bank(bank)) < firmware_end) return true;
+
+  FLASH_EraseInitTypeDef EraseInitStruct;
+  uint32_t SectorError = 0;
+
+  EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
+  EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+  EraseInitStruct.Sector = FLASH_LOG_FIRST_SECTOR + bank;
+  EraseInitStruct.NbSectors = 1;
+
+  HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAGS_TO_CLEAR);
+
+  // Most STM32F4 flash does not allow reading from flash during erase operations
+  TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
+  hal.isr_off();
+  const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
+  hal.isr_on();
+  TERN_(HAS_PAUSE_SERVO_OUTPUT, RESUME_SERVO_OUTPUT());
+
+  HAL_FLASH_Lock();
+  return status != HAL_OK;
+}
+
+bool flash_log_program(const uint8_t *address, const uint8_t *data) {
+  HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAGS_TO_CLEAR);
+  const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, uint32_t(address), *(const uint32_t *)data);
+  HAL_FLASH_Lock();
+  return status != HAL_OK;
+}
+
+#endif // FLASH_EEPROM_LOG
+#endif // HAL_STM32
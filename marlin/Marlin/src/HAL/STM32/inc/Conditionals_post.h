@@ -28,6 +28,22 @@
   #define USE_SHARED_EEPROM 1
 #endif
 
+// Flash banks for the settings log, which also spreads the writes
+#if ENABLED(FLASH_EEPROM_LOG)
+  #undef FLASH_EEPROM_LEVELING
+  #ifndef FLASH_LOG_BANKS
+    #define FLASH_LOG_BANKS        2
+  #endif
+  #ifndef FLASH_SECTOR
+    #define FLASH_SECTOR           (FLASH_SECTOR_TOTAL - 1)
+  #endif
+  #ifndef FLASH_UNIT_SIZE
+    #define FLASH_UNIT_SIZE        0x20000 // 128K
+  #endif
+  #define FLASH_LOG_BANK_SIZE      FLASH_UNIT_SIZE
+  #define FLASH_LOG_WORD           4
+#endif
+
 // Some STM32F4 boards may lose steps when saving to EEPROM during print (PR #17946)
 #if defined(STM32F4xx) && ENABLED(FLASH_EEPROM_EMULATION) && PRINTCOUNTER_SAVE_INTERVAL > 0
   #define PRINTCOUNTER_SYNC
@@ -40,6 +40,10 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4/H7 hardware." // IRON
 #endif
 
+#if ENABLED(FLASH_EEPROM_LOG) && NOT_TARGET(STM32F4xx)
+  #error "FLASH_EEPROM_LOG is currently only supported on STM32F4 hardware."
+#endif
+
 #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
   #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on STM32."
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
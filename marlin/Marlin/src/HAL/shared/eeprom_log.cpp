@@ -0,0 +1,246 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Persistent storage as a log of changes in flash. See eeprom_log.h.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(FLASH_EEPROM_LOG)
+
+#include "eeprom_api.h"
+#include "eeprom_log.h"
+
+#define DEBUG_OUT ENABLED(EEPROM_CHITCHAT)
+#include "../../core/debug_out.h"
+
+#ifndef MARLIN_EEPROM_SIZE
+  #define MARLIN_EEPROM_SIZE    0x1000 // 4KB
+#endif
+
+#define LOG_MAGIC               0x474C // "LG"
+#define DIRTY_BYTES             4      // Bytes of the image marked as changed together
+
+// A record is a header word followed by its data in whole flash words
+#define RECORD_SIZE(N)          ((FLASH_LOG_WORD) + ((N) + (FLASH_LOG_WORD) - 1) / (FLASH_LOG_WORD) * (FLASH_LOG_WORD))
+
+static_assert(MARLIN_EEPROM_SIZE <= 0xFFFF, "FLASH_EEPROM_LOG requires MARLIN_EEPROM_SIZE of 64K or less.");
+static_assert((FLASH_LOG_WORD) >= 4 && 0 == (FLASH_LOG_WORD) % 4, "FLASH_LOG_WORD must be a multiple of 4 bytes.");
+static_assert((FLASH_LOG_BANKS) >= 2, "FLASH_EEPROM_LOG requires at least 2 FLASH_LOG_BANKS.");
+static_assert((FLASH_LOG_WORD) + RECORD_SIZE(MARLIN_EEPROM_SIZE) <= (FLASH_LOG_BANK_SIZE), "FLASH_LOG_BANK_SIZE is too small for MARLIN_EEPROM_SIZE.");
+
+// The first word of a bank. The bank with the latest lap holds the log.
+typedef struct {
+  uint16_t magic;
+  uint16_t lap;
+} bank_header_t;
+
+// The first word of a record. The data follows in the next word.
+typedef struct {
+  uint16_t index;       // Position in the EEPROM image
+  uint16_t size;        // Bytes of data
+} record_header_t;
+
+static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4)));
+static uint8_t dirty[(MARLIN_EEPROM_SIZE + 8 * (DIRTY_BYTES) - 1) / (8 * (DIRTY_BYTES))];
+static bool eeprom_data_written = false;
+
+static int8_t current_bank = -1;
+static uint16_t current_lap;
+static uint32_t log_end;  // Offset of the next record in the current bank
+
+size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE - eeprom_exclude_size; }
+
+// Program one flash word, padding the data with erased bytes
+static bool program_word(const uint8_t bank, const uint32_t offset, const uint8_t *data, const uint16_t size) {
+  uint8_t word[FLASH_LOG_WORD] __attribute__((aligned(4)));
+  memset(word, 0xFF, sizeof(word));
+  memcpy(word, data, _MIN(size, uint16_t(FLASH_LOG_WORD)));
+  return flash_log_program(flash_log_bank(bank) + offset, word);
+}
+
+// Append part of the image to the log in a bank. The header is programmed last,
+// so a record cut short by a reset ends the log when it's replayed.
+// With 'commit' false the header is left for the caller to program.
+static bool append_record(const uint8_t bank, const uint16_t index, const uint16_t size, const bool commit=true) {
+  for (uint16_t i = 0; i < size; i += FLASH_LOG_WORD)
+    if (program_word(bank, log_end + (FLASH_LOG_WORD) + i, ram_eeprom + index + i, size - i)) return true;
+
+  const record_header_t header = { index, size };
+  if (commit && program_word(bank, log_end, (const uint8_t *)&header, sizeof(header))) return true;
+
+  log_end += RECORD_SIZE(size);
+  return false;
+}
+
+// Start a new lap in the next bank with the whole image
+static bool write_next_bank() {
+  const uint8_t bank = (current_bank + 1) % (FLASH_LOG_BANKS);
+
+  if (flash_log_erase(bank)) {
+    DEBUG_ECHOLNPGM("EEPROM log bank ", bank, " erase failed.");
+    return true;
+  }
+
+  log_end = FLASH_LOG_WORD;
+
+  // The old bank stays valid until the new one has its header, so only
+  // switch to the new bank once it's written. A failed write leaves the
+  // current bank as it was and the next save tries the same bank again.
+  const bank_header_t header = { LOG_MAGIC, uint16_t(current_lap + 1) };
+  if (append_record(bank, 0, MARLIN_EEPROM_SIZE) || program_word(bank, 0, (const uint8_t *)&header, sizeof(header))) {
+    DEBUG_ECHOLNPGM("EEPROM log bank ", bank, " write failed.");
+    log_end = FLASH_LOG_BANK_SIZE;  // Try the new bank again on the next save
+    return true;
+  }
+  current_bank = bank;
+  current_lap = header.lap;
+
+  DEBUG_ECHOLNPGM("EEPROM log moved to bank ", bank, ".");
+  return false;
+}
+
+// Find the current bank and replay its log into the image
+static void load_log() {
+  for (uint8_t b = 0; b < FLASH_LOG_BANKS; b++) {
+    const bank_header_t &header = *(const bank_header_t *)flash_log_bank(b);
+    if (header.magic == LOG_MAGIC && (current_bank < 0 || int16_t(header.lap - current_lap) > 0)) {
+      current_bank = b;
+      current_lap = header.lap;
+    }
+  }
+
+  memset(ram_eeprom, 0xFF, sizeof(ram_eeprom));
+
+  if (current_bank < 0) {
+    // Nothing saved yet. The first save starts the log in bank 0.
+    current_bank = (FLASH_LOG_BANKS) - 1;
+    current_lap = 0;
+    log_end = FLASH_LOG_BANK_SIZE;
+    return;
+  }
+
+  const uint8_t * const bank = flash_log_bank(current_bank);
+  uint32_t offset = FLASH_LOG_WORD;
+  uint16_t records = 0;
+  while (offset + (FLASH_LOG_WORD) <= (FLASH_LOG_BANK_SIZE)) {
+    const record_header_t &header = *(const record_header_t *)(bank + offset);
+    if (header.index == 0xFFFF && header.size == 0xFFFF) break;   // End of the log
+    const uint32_t next = offset + RECORD_SIZE(header.size);
+    if (next > (FLASH_LOG_BANK_SIZE) || uint32_t(header.index) + header.size > MARLIN_EEPROM_SIZE) break;
+    memcpy(ram_eeprom + header.index, bank + offset + (FLASH_LOG_WORD), header.size);
+    offset = next;
+    records++;
+  }
+  log_end = offset;
+
+  // Anything programmed past the end is from an interrupted save,
+  // so the next save will start over in the next bank.
+  for (uint32_t i = offset; i < (FLASH_LOG_BANK_SIZE); i += 4)
+    if (*(const uint32_t *)(bank + i) != 0xFFFFFFFF) { log_end = FLASH_LOG_BANK_SIZE; break; }
+
+  DEBUG_ECHOLNPGM("EEPROM log bank ", current_bank, ": ", records, " records, ", log_end, " bytes.");
+}
+
+bool PersistentStore::access_start() {
+  if (current_bank < 0) load_log();
+  return true;
+}
+
+bool PersistentStore::access_finish() {
+  if (!eeprom_data_written) return true;
+
+  // Append each run of changed bytes as one record. Runs closer than
+  // the size of a header are joined, since a record would cost more.
+  // The header of the first record is programmed after all the others,
+  // so a save cut short by a reset is never replayed in part.
+  uint32_t first_offset = 0;
+  record_header_t first = { 0, 0 };
+  constexpr uint16_t groups = (MARLIN_EEPROM_SIZE + (DIRTY_BYTES) - 1) / (DIRTY_BYTES),
+                     join = ((FLASH_LOG_WORD) + (DIRTY_BYTES) - 1) / (DIRTY_BYTES);
+  for (uint16_t g = 0; g < groups;) {
+    if (!TEST(dirty[g / 8], g % 8)) { g++; continue; }
+
+    uint16_t end = g + 1;
+    for (uint16_t e = end; e < groups && e < end + join; e++)
+      if (TEST(dirty[e / 8], e % 8)) end = e + 1;
+
+    const uint16_t index = g * (DIRTY_BYTES),
+                   size = _MIN(uint16_t(end * (DIRTY_BYTES)), uint16_t(MARLIN_EEPROM_SIZE)) - index;
+
+    if (log_end + RECORD_SIZE(size) > (FLASH_LOG_BANK_SIZE)) {
+      // The new bank gets the whole image, so the records appended so far
+      // are left uncommitted in the old bank.
+      if (write_next_bank()) return false;
+      first.size = 0;
+      break;
+    }
+    const bool is_first = !first.size;
+    if (is_first) { first_offset = log_end; first = { index, size }; }
+    if (append_record(current_bank, index, size, !is_first)) {
+      DEBUG_ECHOLNPGM("EEPROM log write failed at ", log_end, ".");
+      log_end = FLASH_LOG_BANK_SIZE;  // Start over in the next bank
+      return false;
+    }
+    g = end;
+  }
+
+  if (first.size && program_word(current_bank, first_offset, (const uint8_t *)&first, sizeof(first))) {
+    DEBUG_ECHOLNPGM("EEPROM log write failed at ", first_offset, ".");
+    log_end = FLASH_LOG_BANK_SIZE;
+    return false;
+  }
+
+  ZERO(dirty);
+  eeprom_data_written = false;
+  return true;
+}
+
+bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  while (size--) {
+    uint8_t v = *value;
+    const int p = REAL_EEPROM_ADDR(pos);
+    if (v != ram_eeprom[p]) {
+      ram_eeprom[p] = v;
+      SBI(dirty[p / (8 * (DIRTY_BYTES))], (p / (DIRTY_BYTES)) % 8);
+      eeprom_data_written = true;
+    }
+    crc16(crc, &v, 1);
+    pos++;
+    value++;
+  }
+  return false;
+}
+
+bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  do {
+    const uint8_t c = ram_eeprom[REAL_EEPROM_ADDR(pos)];
+    if (writing) *value = c;
+    crc16(crc, &c, 1);
+    pos++;
+    value++;
+  } while (--size);
+  return false;
+}
+
+#endif // FLASH_EEPROM_LOG
@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Log-structured flash EEPROM emulation (FLASH_EEPROM_LOG)
+ *
+ * The flash set aside for settings is split into FLASH_LOG_BANKS banks of
+ * FLASH_LOG_BANK_SIZE bytes, and one bank at a time holds the log. Every
+ * save appends records with only the bytes that changed, each keyed by its
+ * position in the EEPROM image. Loading replays the records in order.
+ *
+ * When the log is full the whole image goes into the next bank as a single
+ * record, so every bank is erased once per turn through all of the banks.
+ *
+ * The HAL provides FLASH_LOG_BANKS, FLASH_LOG_BANK_SIZE, FLASH_LOG_WORD
+ * (the size programmed at once) and the functions below.
+ */
+
+#include <stdint.h>
+
+// Memory-mapped start of a bank
+const uint8_t* flash_log_bank(const uint8_t bank);
+
+// Erase a whole bank. Return 'true' on error.
+bool flash_log_erase(const uint8_t bank);
+
+// Program FLASH_LOG_WORD bytes of erased flash. Return 'true' on error.
+bool flash_log_program(const uint8_t *address, const uint8_t *data);
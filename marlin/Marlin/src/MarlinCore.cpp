@@ -227,6 +227,10 @@
   #include "feature/fancheck.h"
 #endif
 
+#if ENABLED(TELEMETRY_RECORDER)
+  #include "feature/telemetry.h"
+#endif
+
 #if ENABLED(USE_CONTROLLER_FAN)
   #include "feature/controllerfan.h"
 #endif
@@ -770,6 +774,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   #ifdef MAX7219_DEBUG_PROFILE
     CodeProfiler idle_profiler;
   #endif
+  #ifdef LINUX_BENCHMARK
+    Benchmark::Probe idle_probe(Benchmark::IDLE);
+  #endif
 
   #if ENABLED(MARLIN_DEV_MODE)
     static uint16_t idle_depth = 0;
@@ -820,6 +827,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Handle SD Card insert / remove
   TERN_(HAS_MEDIA, card.manage_media());
 
+  // Read ahead in the file being printed
+  TERN_(SD_READ_AHEAD, card.prefetch());
+
   // Announce Host Keepalive state (if any)
   TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
 
@@ -857,6 +867,7 @@ void idle(const bool no_stepper_sleep/*=false*/) {
       TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
       TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+      TERN_(TELEMETRY_RECORDER, telemetry.auto_reporter.tick());
       TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
     }
   #endif
@@ -259,6 +259,7 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
 // Refresh after other values have been updated
 void LevelingBilinear::refresh_bed_level() {
   TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
+  TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh());
   cached_rel.x = cached_rel.y = -999.999;
   cached_g.x = cached_g.y = -99;
 }
@@ -277,89 +278,93 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
-// Get the Z adjustment for non-linear bed leveling
-float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+#if DISABLED(MESH_CELL_COEFFICIENTS)
 
-  static float z1, d2, z3, d4, L, D;
+  // Get the Z adjustment for non-linear bed leveling
+  float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
-  static xy_pos_t ratio;
+    static float z1, d2, z3, d4, L, D;
 
-  // Whole units for the grid line indices. Constrained within bounds.
-  static xy_int8_t thisg, nextg;
+    static xy_pos_t ratio;
 
-  // XY relative to the probed area
-  xy_pos_t rel = raw - grid_start.asFloat();
+    // Whole units for the grid line indices. Constrained within bounds.
+    static xy_int8_t thisg, nextg;
 
-  #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
-    #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
-  #else
-    #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
-  #endif
-
-  if (cached_rel.x != rel.x) {
-    cached_rel.x = rel.x;
-    ratio.x = rel.x * ABL_BG_FACTOR(x);
-    const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
-    ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
+    // XY relative to the probed area
+    xy_pos_t rel = raw - grid_start.asFloat();
 
-    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
-      // Beyond the grid maintain height at grid edges
-      NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
+    #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+      #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
+    #else
+      #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
     #endif
 
-    thisg.x = gx;
-    nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
-  }
-
-  if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
-
-    if (cached_rel.y != rel.y) {
-      cached_rel.y = rel.y;
-      ratio.y = rel.y * ABL_BG_FACTOR(y);
-      const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
-      ratio.y -= gy;
+    if (cached_rel.x != rel.x) {
+      cached_rel.x = rel.x;
+      ratio.x = rel.x * ABL_BG_FACTOR(x);
+      const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
+      ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
 
       #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
         // Beyond the grid maintain height at grid edges
-        NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+        NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
       #endif
 
-      thisg.y = gy;
-      nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      thisg.x = gx;
+      nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
     }
 
-    if (cached_g != thisg) {
-      cached_g = thisg;
-      // Z at the box corners
-      z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
-      d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
-      z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
-      d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
-    }
+    if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
 
-    // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
-                L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
-    const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+      if (cached_rel.y != rel.y) {
+        cached_rel.y = rel.y;
+        ratio.y = rel.y * ABL_BG_FACTOR(y);
+        const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
+        ratio.y -= gy;
 
-    D = R - L;
-  }
+        #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+          // Beyond the grid maintain height at grid edges
+          NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+        #endif
 
-  const float offset = L + ratio.x * D;   // the offset almost always changes
+        thisg.y = gy;
+        nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      }
 
-  /*
-  static float last_offset = 0;
-  if (ABS(last_offset - offset) > 0.2) {
-    SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
-    SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
-    SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
-    SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
-    SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
+      if (cached_g != thisg) {
+        cached_g = thisg;
+        // Z at the box corners
+        z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
+        d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
+        z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
+        d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      }
+
+      // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
+                  L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
+      const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+
+      D = R - L;
+    }
+
+    const float offset = L + ratio.x * D;   // the offset almost always changes
+
+    /*
+    static float last_offset = 0;
+    if (ABS(last_offset - offset) > 0.2) {
+      SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
+      SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
+      SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
+      SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
+      SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
+    }
+    last_offset = offset;
+    //*/
+
+    return offset;
   }
-  last_offset = offset;
-  //*/
 
-  return offset;
-}
+#endif // !MESH_CELL_COEFFICIENTS
 
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
@@ -23,6 +23,10 @@
 
 #include "../../../inc/MarlinConfigPre.h"
 
+#if ENABLED(MESH_CELL_COEFFICIENTS)
+  #include "../mesh_cells.h"
+#endif
+
 class LevelingBilinear {
 public:
   static bed_mesh_t z_values;
@@ -59,7 +63,11 @@ public:
   static bool mesh_is_valid() { return has_mesh(); }
   static float get_mesh_x(const uint8_t i) { return grid_start.x + i * grid_spacing.x; }
   static float get_mesh_y(const uint8_t j) { return grid_start.y + j * grid_spacing.y; }
-  static float get_z_correction(const xy_pos_t &raw);
+  #if ENABLED(MESH_CELL_COEFFICIENTS)
+    static float get_z_correction(const xy_pos_t &raw) { return mesh_cells.get_z(raw); }
+  #else
+    static float get_z_correction(const xy_pos_t &raw);
+  #endif
   static constexpr float get_z_offset() { return 0.0f; }
 
   #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
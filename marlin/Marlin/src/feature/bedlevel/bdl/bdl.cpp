@@ -109,6 +109,66 @@ float BDS_Leveling::read() {
   return check(data) ? NAN : interpret(data);
 }
 
+#if ENABLED(BD_SENSOR_PROBE_NO_STOP)
+
+  /**
+   * Sweep probing
+   *
+   * G29 moves the nozzle along each row of the mesh without stopping, and
+   * the sensor is sampled every BD_SENSOR_SWEEP_INTERVAL ms in the meantime.
+   * Each sample is tagged with the stepper position along the row at the
+   * middle of the reading, then added to the nearest grid points with a
+   * weight falling off to zero at half the grid spacing. Each point then
+   * gets the weighted mean of the distances sampled around it.
+   */
+
+  AxisEnum BDS_Leveling::sweep_axis;
+  float BDS_Leveling::sweep_origin, BDS_Leveling::sweep_spacing;
+  uint8_t BDS_Leveling::sweep_count;
+  float BDS_Leveling::sweep_sum[BD_SWEEP_MAX_POINTS], BDS_Leveling::sweep_weight[BD_SWEEP_MAX_POINTS];
+
+  // Start a row of 'count' points at 'origin' + i * 'spacing' in nozzle coordinates
+  void BDS_Leveling::sweep_start(const AxisEnum axis, const float origin, const float spacing, const uint8_t count) {
+    sweep_axis = axis;
+    sweep_origin = origin;
+    sweep_spacing = spacing;
+    sweep_count = _MIN(count, uint8_t(BD_SWEEP_MAX_POINTS));
+    ZERO(sweep_sum);
+    ZERO(sweep_weight);
+  }
+
+  // Take a sample if it's time. Call repeatedly while the row is moving.
+  void BDS_Leveling::sweep_sample() {
+    static millis_t next_sample_ms = 0;
+    const millis_t ms = millis();
+    if (PENDING(ms, next_sample_ms)) return;
+    next_sample_ms = ms + (BD_SENSOR_SWEEP_INTERVAL);
+
+    const float pos1 = planner.get_axis_position_mm(sweep_axis);
+    const uint16_t data = BD_I2C_SENSOR.BD_i2c_read();
+    const float pos2 = planner.get_axis_position_mm(sweep_axis);
+    if (!BD_I2C_SENSOR.BD_Check_OddEven(data) || !good_data(data) || (data & 0x3FF) >= (MAX_BD_HEIGHT) * 100 - 10) return;
+
+    // Position in grid units, and the two points on either side of it
+    const float g = ((pos1 + pos2) * 0.5f - sweep_origin) / sweep_spacing;
+    const int8_t i = FLOOR(g);
+    const float dist = interpret(data);
+    for (int8_t n = i; n <= i + 1; ++n) {
+      if (!WITHIN(n, 0, sweep_count - 1)) continue;
+      const float w = 1.0f - 2.0f * ABS(g - n);
+      if (w <= 0) continue;
+      sweep_sum[n] += w * dist;
+      sweep_weight[n] += w;
+    }
+  }
+
+  // The distance measured at a point of the row, or NAN if it wasn't sampled
+  float BDS_Leveling::sweep_result(const uint8_t index) {
+    return (index < sweep_count && sweep_weight[index] > 0) ? sweep_sum[index] / sweep_weight[index] : NAN;
+  }
+
+#endif // BD_SENSOR_PROBE_NO_STOP
+
 void BDS_Leveling::process() {
   if (config_state == BDS_IDLE && printingIsActive()) return;
   static millis_t next_check_ms = 0; // starting at T=0
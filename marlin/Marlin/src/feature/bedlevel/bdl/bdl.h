@@ -27,6 +27,13 @@
   #define BD_SENSOR_HOME_Z_POSITION 0.5
 #endif
 
+#if ENABLED(BD_SENSOR_PROBE_NO_STOP)
+  #define BD_SWEEP_MAX_POINTS _MAX(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y)
+  #ifndef BD_SENSOR_SWEEP_INTERVAL
+    #define BD_SENSOR_SWEEP_INTERVAL 2  // (ms) Time between samples
+  #endif
+#endif
+
 enum BDS_State : int8_t {
   BDS_IDLE,
   BDS_VERSION         = -1,
@@ -47,6 +54,19 @@ public:
   static float interpret(const uint16_t data);
   static float good_data(const uint16_t data) { return (data & 0x3FF) < 1016; }
   static bool check(const uint16_t data, const bool raw_data=false, const bool hicheck=false);
+
+  #if ENABLED(BD_SENSOR_PROBE_NO_STOP)
+    // Sweep probing: samples taken while moving along a row of the mesh
+    static void sweep_start(const AxisEnum axis, const float origin, const float spacing, const uint8_t count);
+    static void sweep_sample();
+    static float sweep_result(const uint8_t index);
+
+  private:
+    static AxisEnum sweep_axis;
+    static float sweep_origin, sweep_spacing;
+    static uint8_t sweep_count;
+    static float sweep_sum[BD_SWEEP_MAX_POINTS], sweep_weight[BD_SWEEP_MAX_POINTS];
+  #endif
 };
 
 extern BDS_Leveling bdl;
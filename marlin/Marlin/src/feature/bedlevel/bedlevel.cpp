@@ -61,6 +61,9 @@ void set_bed_leveling_enabled(const bool enable/*=true*/) {
 
   const bool can_change = TERN1(AUTO_BED_LEVELING_BILINEAR, !enable || leveling_is_valid());
 
+  // The mesh may have been edited since leveling was last enabled
+  TERN_(MESH_CELL_COEFFICIENTS, if (can_change && enable) mesh_cells.refresh());
+
   if (can_change && enable != planner.leveling_active) {
 
     auto _report_leveling = []{
@@ -23,6 +23,10 @@
 
 #include "../../../inc/MarlinConfig.h"
 
+#if ENABLED(MESH_CELL_COEFFICIENTS)
+  #include "../mesh_cells.h"
+#endif
+
 enum MeshLevelingState : char {
   MeshReport,     // G29 S0
   MeshStart,      // G29 S1
@@ -55,7 +59,10 @@ public:
 
   static bool mesh_is_valid() { return has_mesh(); }
 
-  static void set_z(const int8_t px, const int8_t py, const_float_t z) { z_values[px][py] = z; }
+  static void set_z(const int8_t px, const int8_t py, const_float_t z) {
+    z_values[px][py] = z;
+    TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh_point(px, py));
+  }
 
   static void zigzag(const int8_t index, int8_t &px, int8_t &py) {
     px = index % (GRID_MAX_POINTS_X);
@@ -106,16 +113,20 @@ public:
 
   static float get_z_offset() { return z_offset; }
 
-  static float get_z_correction(const xy_pos_t &pos) {
-    const xy_uint8_t ind = cell_indexes(pos);
-    const float x1 = index_to_xpos[ind.x], x2 = index_to_xpos[ind.x+1],
-                y1 = index_to_ypos[ind.y], y2 = index_to_ypos[ind.y+1],
-                z1 = calc_z0(pos.x, x1, z_values[ind.x][ind.y  ], x2, z_values[ind.x+1][ind.y  ]),
-                z2 = calc_z0(pos.x, x1, z_values[ind.x][ind.y+1], x2, z_values[ind.x+1][ind.y+1]),
-                zf = calc_z0(pos.y, y1, z1, y2, z2);
-
-    return zf;
-  }
+  #if ENABLED(MESH_CELL_COEFFICIENTS)
+    static float get_z_correction(const xy_pos_t &pos) { return mesh_cells.get_z(pos); }
+  #else
+    static float get_z_correction(const xy_pos_t &pos) {
+      const xy_uint8_t ind = cell_indexes(pos);
+      const float x1 = index_to_xpos[ind.x], x2 = index_to_xpos[ind.x+1],
+                  y1 = index_to_ypos[ind.y], y2 = index_to_ypos[ind.y+1],
+                  z1 = calc_z0(pos.x, x1, z_values[ind.x][ind.y  ], x2, z_values[ind.x+1][ind.y  ]),
+                  z2 = calc_z0(pos.x, x1, z_values[ind.x][ind.y+1], x2, z_values[ind.x+1][ind.y+1]),
+                  zf = calc_z0(pos.y, y1, z1, y2, z2);
+
+      return zf;
+    }
+  #endif
 
   #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
     static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint8_t x_splits=0xFF, uint8_t y_splits=0xFF);
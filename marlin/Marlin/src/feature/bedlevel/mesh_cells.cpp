@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MESH_CELL_COEFFICIENTS)
+
+#include "bedlevel.h"
+
+MeshCells mesh_cells;
+
+MeshCells::cell_t MeshCells::cells[GRID_MAX_CELLS_Y][GRID_MAX_CELLS_X];
+xy_pos_t MeshCells::origin;
+xy_float_t MeshCells::factor;
+
+// Undefined (NAN) mesh points count as zero, as in UBL's segmented moves
+static float defined_z(const uint8_t px, const uint8_t py) {
+  const float z = bedlevel.z_values[px][py];
+  return isnan(z) ? 0.0f : z;
+}
+
+static void refresh_cell(const uint8_t cx, const uint8_t cy) {
+  const float z00 = defined_z(cx, cy    ), z10 = defined_z(cx + 1, cy    ),
+              z01 = defined_z(cx, cy + 1), z11 = defined_z(cx + 1, cy + 1);
+
+  MeshCells::cell_t &c = MeshCells::cells[cy][cx];
+  c.a = z00;
+  c.b = z10 - z00;
+  c.c = z01 - z00;
+  c.d = z11 - z10 - z01 + z00;
+}
+
+void MeshCells::refresh() {
+  #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+    if (!bedlevel.has_mesh()) {
+      // No grid yet, so every position maps to the first cell with no correction
+      origin.reset();
+      factor.reset();
+      ZERO(cells);
+      return;
+    }
+    origin = bedlevel.grid_start;
+    factor = bedlevel.grid_spacing.reciprocal();
+  #else
+    origin.set(MESH_MIN_X, MESH_MIN_Y);
+    factor.set(RECIPROCAL(MESH_X_DIST), RECIPROCAL(MESH_Y_DIST));
+  #endif
+
+  for (uint8_t cy = 0; cy < GRID_MAX_CELLS_Y; ++cy)
+    for (uint8_t cx = 0; cx < GRID_MAX_CELLS_X; ++cx)
+      refresh_cell(cx, cy);
+}
+
+void MeshCells::refresh_point(const uint8_t px, const uint8_t py) {
+  for (uint8_t cy = _MAX(py, 1) - 1; cy <= _MIN(py, GRID_MAX_CELLS_Y - 1); ++cy)
+    for (uint8_t cx = _MAX(px, 1) - 1; cx <= _MIN(px, GRID_MAX_CELLS_X - 1); ++cx)
+      refresh_cell(cx, cy);
+}
+
+#endif // MESH_CELL_COEFFICIENTS
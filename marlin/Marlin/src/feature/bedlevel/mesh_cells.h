@@ -0,0 +1,114 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Mesh cell coefficients
+ *
+ * Holds the bilinear patch z = a + b*u + c*v + d*u*v for every cell of the
+ * active mesh, where (u, v) is the position within the cell in cell units.
+ * The patches are rebuilt whenever the mesh changes, so a Z correction is a
+ * cell lookup followed by three multiply-adds, with no divisions.
+ *
+ * Shared by AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL and MESH_BED_LEVELING.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR) && DISABLED(EXTRAPOLATE_BEYOND_GRID)
+  #define MESH_CELLS_CLAMP 1  // Beyond the grid keep the height of the nearest edge
+#endif
+
+class MeshCells {
+public:
+  typedef struct { float a, b, c, d; } cell_t;
+
+  // One row of cells per Y index so walking along X stays in contiguous memory
+  static cell_t cells[GRID_MAX_CELLS_Y][GRID_MAX_CELLS_X];
+  static xy_pos_t origin;     // Position of the first mesh point
+  static xy_float_t factor;   // Cells per mm
+
+  // Rebuild all cells from the mesh
+  static void refresh();
+
+  // Rebuild the (up to four) cells that share a changed mesh point
+  static void refresh_point(const uint8_t px, const uint8_t py);
+
+  // Z correction at a position
+  static float get_z(const xy_pos_t &raw) {
+    xy_int8_t ci;
+    const xy_float_t uv = locate((raw - origin) * factor, ci);
+    return value(cells[ci.y][ci.x], uv);
+  }
+
+  /**
+   * Walk a line through the mesh in equal steps, like a DDA. Each step adds the
+   * step delta to the position within the current cell, and looks for another
+   * cell only when that position leaves the current one.
+   */
+  class Walker {
+    xy_float_t uv, duv;
+    xy_int8_t ci;
+    const cell_t *cell;
+
+    void relocate() {
+      uv = locate(uv + ci.asFloat(), ci);
+      cell = &cells[ci.y][ci.x];
+    }
+
+  public:
+    Walker(const xy_pos_t &start, const xy_float_t &step) : uv((start - origin) * factor), duv(step * factor), ci{0, 0} { relocate(); }
+
+    // Z correction at the current position
+    float z() const { return value(*cell, uv); }
+
+    // Advance by one step and return the Z correction there
+    float next() {
+      uv += duv;
+      if (!WITHIN(uv.x, 0.0f, 1.0f) || !WITHIN(uv.y, 0.0f, 1.0f)) relocate();
+      return z();
+    }
+  };
+
+private:
+
+  // Evaluate a cell patch. Beyond the mesh the edge cells extend their slope,
+  // or keep the height at the edge with MESH_CELLS_CLAMP.
+  FORCE_INLINE static float value(const cell_t &c, xy_float_t uv) {
+    #if MESH_CELLS_CLAMP
+      LIMIT(uv.x, 0.0f, 1.0f);
+      LIMIT(uv.y, 0.0f, 1.0f);
+    #endif
+    return c.a + uv.x * c.b + uv.y * (c.c + uv.x * c.d);
+  }
+
+  // Split a position in cell units into a cell index and the position within that cell
+  static xy_float_t locate(const xy_float_t &f, xy_int8_t &ci) {
+    ci.set(
+      int8_t(constrain(FLOOR(f.x), 0, (GRID_MAX_CELLS_X) - 1)),
+      int8_t(constrain(FLOOR(f.y), 0, (GRID_MAX_CELLS_Y) - 1))
+    );
+    return f - ci.asFloat();
+  }
+};
+
+extern MeshCells mesh_cells;
@@ -91,6 +91,7 @@ void unified_bed_leveling::reset() {
   set_bed_leveling_enabled(false);
   storage_slot = -1;
   ZERO(z_values);
+  TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh());
   #if ENABLED(EXTENSIBLE_UI)
     GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
   #endif
@@ -107,6 +108,7 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
     z_values[x][y] = value;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, value));
   }
+  TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh());
 }
 
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
@@ -25,6 +25,10 @@
 
 #include "../../../module/motion.h"
 
+#if ENABLED(MESH_CELL_COEFFICIENTS)
+  #include "../mesh_cells.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
 
@@ -130,7 +134,10 @@ public:
 
   unified_bed_leveling();
 
-  FORCE_INLINE static void set_z(const int8_t px, const int8_t py, const_float_t z) { z_values[px][py] = z; }
+  FORCE_INLINE static void set_z(const int8_t px, const int8_t py, const_float_t z) {
+    z_values[px][py] = z;
+    TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh_point(px, py));
+  }
 
   static int8_t cell_index_x_raw(const_float_t x) {
     return FLOOR((x - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST));
@@ -252,8 +259,6 @@ public:
    * on the Y position within the cell.
    */
   static float get_z_correction(const_float_t rx0, const_float_t ry0) {
-    const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
-
     /**
      * Check if the requested location is off the mesh.  If so, and
      * UBL_Z_RAISE_WHEN_OFF_MESH is specified, that value is returned.
@@ -263,20 +268,35 @@ public:
         return UBL_Z_RAISE_WHEN_OFF_MESH;
     #endif
 
-    const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1;
-    const float x0 = get_mesh_x(cx), x1 = get_mesh_x(cx + 1),
-                z1 = calc_z0(rx0, x0, z_values[cx][cy], x1, z_values[mx][cy]),
-                z2 = calc_z0(rx0, x0, z_values[cx][my], x1, z_values[mx][my]);
-    float z0 = calc_z0(ry0, get_mesh_y(cy), z1, get_mesh_y(cy + 1), z2);
+    #if ENABLED(MESH_CELL_COEFFICIENTS)
 
-    if (isnan(z0)) { // If part of the Mesh is undefined, it will show up as NAN
-      z0 = 0.0;      // in z_values[][] and propagate through the calculations.
-                     // If our correction is NAN, we throw it out because part of
-                     // the Mesh is undefined and we don't have the information
-                     // needed to complete the height correction.
+      // The cells treat undefined points as zero, but here a cell with any undefined point gives no correction
+      const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
+      const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1;
+      const bool undefined = isnan(z_values[cx][cy]) || isnan(z_values[mx][cy]) || isnan(z_values[cx][my]) || isnan(z_values[mx][my]);
+      const float z0 = undefined ? 0.0f : mesh_cells.get_z(xy_pos_t({ rx0, ry0 }));
+      if (undefined && DEBUGGING(MESH_ADJUST)) DEBUG_ECHOLNPGM("??? Yikes! NAN in ");
 
-      if (DEBUGGING(MESH_ADJUST)) DEBUG_ECHOLNPGM("??? Yikes! NAN in ");
-    }
+    #else
+
+      const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
+
+      const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1;
+      const float x0 = get_mesh_x(cx), x1 = get_mesh_x(cx + 1),
+                  z1 = calc_z0(rx0, x0, z_values[cx][cy], x1, z_values[mx][cy]),
+                  z2 = calc_z0(rx0, x0, z_values[cx][my], x1, z_values[mx][my]);
+      float z0 = calc_z0(ry0, get_mesh_y(cy), z1, get_mesh_y(cy + 1), z2);
+
+      if (isnan(z0)) { // If part of the Mesh is undefined, it will show up as NAN
+        z0 = 0.0;      // in z_values[][] and propagate through the calculations.
+                       // If our correction is NAN, we throw it out because part of
+                       // the Mesh is undefined and we don't have the information
+                       // needed to complete the height correction.
+
+        if (DEBUGGING(MESH_ADJUST)) DEBUG_ECHOLNPGM("??? Yikes! NAN in ");
+      }
+
+    #endif
 
     if (DEBUGGING(MESH_ADJUST))
       DEBUG_ECHOLN(F("get_z_correction("), rx0, F(", "), ry0, F(") => "), p_float_t(z0, 6));
@@ -1487,6 +1487,8 @@ void unified_bed_leveling::smart_fill_mesh() {
 
   void unified_bed_leveling::tilt_mesh_based_on_probed_grid(const bool do_3_pt_leveling) {
 
+    TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh()); // Earlier phases may have changed the mesh
+
     float measured_z;
     bool abort_flag = false;
 
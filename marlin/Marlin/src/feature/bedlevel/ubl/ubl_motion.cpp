@@ -402,87 +402,109 @@
       const float fade_scaling_factor = planner.fade_scaling_factor_for_z(destination.z);
     #endif
 
-    // Move to first segment destination
-    raw += diff;
+    #if ENABLED(MESH_CELL_COEFFICIENTS)
 
-    for (;;) {  // for each mesh cell encountered during the move
+      // Walk the mesh cells along the move, so each segment's correction is a few multiply-adds
+      MeshCells::Walker walker(raw, diff);
 
-      // Compute mesh cell invariants that remain constant for all segments within cell.
-      // Note for cell index, if point is outside the mesh grid (in MESH_INSET perimeter)
-      // the bilinear interpolation from the adjacent cell within the mesh will still work.
-      // Inner loop will exit each time (because out of cell bounds) but will come back
-      // in top of loop and again re-find same adjacent cell and use it, just less efficient
-      // for mesh inset area.
+      while (--segments) {
+        raw += diff;
+        const float oldz = raw.z;
+        raw.z += walker.next() TERN_(ENABLE_LEVELING_FADE_HEIGHT, * fade_scaling_factor);
+        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+        raw.z = oldz;
+      }
 
-      xy_int8_t icell = {
-        int8_t((raw.x - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST)),
-        int8_t((raw.y - (MESH_MIN_Y)) * RECIPROCAL(MESH_Y_DIST))
-      };
-      LIMIT(icell.x, 0, GRID_MAX_CELLS_X);
-      LIMIT(icell.y, 0, GRID_MAX_CELLS_Y);
+      // Use the destination for the last segment to be exact
+      raw = destination;
+      raw.z += walker.next() TERN_(ENABLE_LEVELING_FADE_HEIGHT, * fade_scaling_factor);
+      planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
 
-      const int8_t ncellx = _MIN(icell.x+1, GRID_MAX_CELLS_X),
-                   ncelly = _MIN(icell.y+1, GRID_MAX_CELLS_Y);
-      float z_x0y0 = z_values[icell.x][icell.y],  // z at lower left corner
-            z_x1y0 = z_values[ncellx ][icell.y],  // z at upper left corner
-            z_x0y1 = z_values[icell.x][ncelly ],  // z at lower right corner
-            z_x1y1 = z_values[ncellx ][ncelly ];  // z at upper right corner
+    #else
 
-      if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
-      if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
-      if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
-      if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
+      // Move to first segment destination
+      raw += diff;
 
-      const xy_pos_t pos = { get_mesh_x(icell.x), get_mesh_y(icell.y) };
-      xy_pos_t cell = raw - pos;
+      for (;;) {  // for each mesh cell encountered during the move
 
-      const float z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST),   // z slope per x along y0 (lower left to lower right)
-                  z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);   // z slope per x along y1 (upper left to upper right)
+        // Compute mesh cell invariants that remain constant for all segments within cell.
+        // Note for cell index, if point is outside the mesh grid (in MESH_INSET perimeter)
+        // the bilinear interpolation from the adjacent cell within the mesh will still work.
+        // Inner loop will exit each time (because out of cell bounds) but will come back
+        // in top of loop and again re-find same adjacent cell and use it, just less efficient
+        // for mesh inset area.
 
-            float z_cxy0 = z_x0y0 + z_xmy0 * cell.x;        // z height along y0 at cell.x (changes for each cell.x in cell)
+        xy_int8_t icell = {
+          int8_t((raw.x - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST)),
+          int8_t((raw.y - (MESH_MIN_Y)) * RECIPROCAL(MESH_Y_DIST))
+        };
+        LIMIT(icell.x, 0, GRID_MAX_CELLS_X);
+        LIMIT(icell.y, 0, GRID_MAX_CELLS_Y);
 
-      const float z_cxy1 = z_x0y1 + z_xmy1 * cell.x,        // z height along y1 at cell.x
-                  z_cxyd = z_cxy1 - z_cxy0;                 // z height difference along cell.x from y0 to y1
+        const int8_t ncellx = _MIN(icell.x+1, GRID_MAX_CELLS_X),
+                     ncelly = _MIN(icell.y+1, GRID_MAX_CELLS_Y);
+        float z_x0y0 = z_values[icell.x][icell.y],  // z at lower left corner
+              z_x1y0 = z_values[ncellx ][icell.y],  // z at upper left corner
+              z_x0y1 = z_values[icell.x][ncelly ],  // z at lower right corner
+              z_x1y1 = z_values[ncellx ][ncelly ];  // z at upper right corner
 
-            float z_cxym = z_cxyd * RECIPROCAL(MESH_Y_DIST); // z slope per y along cell.x from pos.y to y1 (changes for each cell.x in cell)
+        if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
+        if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
+        if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
+        if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
 
-      //    float z_cxcy = z_cxy0 + z_cxym * cell.y;        // interpolated mesh z height along cell.x at cell.y (do inside the segment loop)
+        const xy_pos_t pos = { get_mesh_x(icell.x), get_mesh_y(icell.y) };
+        xy_pos_t cell = raw - pos;
 
-      // As subsequent segments step through this cell, the z_cxy0 intercept will change
-      // and the z_cxym slope will change, both as a function of cell.x within the cell, and
-      // each change by a constant for fixed segment lengths.
+        const float z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST),   // z slope per x along y0 (lower left to lower right)
+                    z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);   // z slope per x along y1 (upper left to upper right)
 
-      const float z_sxy0 = z_xmy0 * diff.x,                                       // per-segment adjustment to z_cxy0
-                  z_sxym = (z_xmy1 - z_xmy0) * RECIPROCAL(MESH_Y_DIST) * diff.x;  // per-segment adjustment to z_cxym
+              float z_cxy0 = z_x0y0 + z_xmy0 * cell.x;        // z height along y0 at cell.x (changes for each cell.x in cell)
 
-      for (;;) {  // for all segments within this mesh cell
+        const float z_cxy1 = z_x0y1 + z_xmy1 * cell.x,        // z height along y1 at cell.x
+                    z_cxyd = z_cxy1 - z_cxy0;                 // z height difference along cell.x from y0 to y1
 
-        if (--segments == 0) raw = destination;     // if this is last segment, use destination for exact
+              float z_cxym = z_cxyd * RECIPROCAL(MESH_Y_DIST); // z slope per y along cell.x from pos.y to y1 (changes for each cell.x in cell)
 
-        const float z_cxcy = (z_cxy0 + z_cxym * cell.y) // interpolated mesh z height along cell.x at cell.y
-          TERN_(ENABLE_LEVELING_FADE_HEIGHT, * fade_scaling_factor); // apply fade factor to interpolated height
+        //    float z_cxcy = z_cxy0 + z_cxym * cell.y;        // interpolated mesh z height along cell.x at cell.y (do inside the segment loop)
 
-        const float oldz = raw.z; raw.z += z_cxcy;
-        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
-        raw.z = oldz;
+        // As subsequent segments step through this cell, the z_cxy0 intercept will change
+        // and the z_cxym slope will change, both as a function of cell.x within the cell, and
+        // each change by a constant for fixed segment lengths.
 
-        if (segments == 0)                        // done with last segment
-          return false;                           // didn't set current from destination
+        const float z_sxy0 = z_xmy0 * diff.x,                                       // per-segment adjustment to z_cxy0
+                    z_sxym = (z_xmy1 - z_xmy0) * RECIPROCAL(MESH_Y_DIST) * diff.x;  // per-segment adjustment to z_cxym
 
-        raw += diff;
-        cell += diff;
+        for (;;) {  // for all segments within this mesh cell
+
+          if (--segments == 0) raw = destination;     // if this is last segment, use destination for exact
+
+          const float z_cxcy = (z_cxy0 + z_cxym * cell.y) // interpolated mesh z height along cell.x at cell.y
+            TERN_(ENABLE_LEVELING_FADE_HEIGHT, * fade_scaling_factor); // apply fade factor to interpolated height
+
+          const float oldz = raw.z; raw.z += z_cxcy;
+          planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+          raw.z = oldz;
 
-        if (!WITHIN(cell.x, 0, MESH_X_DIST) || !WITHIN(cell.y, 0, MESH_Y_DIST))    // done within this cell, break to next
-          break;
+          if (segments == 0)                        // done with last segment
+            return false;                           // didn't set current from destination
 
-        // Next segment still within same mesh cell, adjust the per-segment
-        // slope and intercept to compute next z height.
+          raw += diff;
+          cell += diff;
 
-        z_cxy0 += z_sxy0;   // adjust z_cxy0 by per-segment z_sxy0
-        z_cxym += z_sxym;   // adjust z_cxym by per-segment z_sxym
+          if (!WITHIN(cell.x, 0, MESH_X_DIST) || !WITHIN(cell.y, 0, MESH_Y_DIST))    // done within this cell, break to next
+            break;
 
-      } // segment loop
-    } // cell loop
+          // Next segment still within same mesh cell, adjust the per-segment
+          // slope and intercept to compute next z height.
+
+          z_cxy0 += z_sxy0;   // adjust z_cxy0 by per-segment z_sxy0
+          z_cxym += z_sxym;   // adjust z_cxym by per-segment z_sxym
+
+        } // segment loop
+      } // cell loop
+
+    #endif
 
     return false; // caller will update current_position
   }
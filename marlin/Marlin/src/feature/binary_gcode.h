@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Binary G-code (BINARY_GCODE)
+ *
+ * A compact framed encoding for the most common motion commands. Values
+ * arrive as little-endian floats, so the parser points at them directly
+ * instead of running strtod on text.
+ *
+ *   Frame   : SYNC LEN PAYLOAD[LEN] CRC16
+ *   SYNC    : 0xF5, which never starts an ASCII command
+ *   CRC16   : CRC-16/XMODEM of LEN and PAYLOAD, little-endian
+ *   PAYLOAD : N(uint16) CMD(uint8) MASK(uint16) VALUE(float)...
+ *
+ * N is the low 16 bits of the line number and follows the same rules as
+ * an ASCII 'N' parameter, so resend requests work as usual. Each bit set
+ * in MASK adds one VALUE for the parameter at that position in
+ * BINARY_GCODE_FIELDS. A reference encoder is MarlinBinaryGcode.py in
+ * buildroot/share/scripts.
+ *
+ * In the command queue a frame is stored as SYNC CMD MASK VALUE...
+ */
+
+#include <stdint.h>
+
+#define BINARY_GCODE_SYNC       0xF5
+#define BINARY_GCODE_FIELDS     "XYZEFIJRPST"
+
+enum BinaryGcodeCommand : uint8_t {
+  BGC_G0, BGC_G1, BGC_G2, BGC_G3, BGC_G92, BGC_M204,
+  BGC_COUNT
+};
+
+// Frame byte offsets
+enum BinaryGcodeFrame : uint8_t {
+  BGF_SYNC, BGF_LEN, BGF_N, BGF_CMD = BGF_N + 2, BGF_MASK, BGF_VALUES = BGF_MASK + 2
+};
+
+// Queued command byte offsets
+enum BinaryGcodeQueued : uint8_t {
+  BGQ_SYNC, BGQ_CMD, BGQ_MASK, BGQ_VALUES = BGQ_MASK + 2
+};
+
+// The smallest payload holds N, CMD, and MASK with no values
+#define BINARY_GCODE_MIN_PAYLOAD (BGF_VALUES - BGF_N)
+
+// Total bytes in a frame with the given payload length
+#define BINARY_GCODE_FRAME_SIZE(LEN) ((LEN) + BGF_N + 2)
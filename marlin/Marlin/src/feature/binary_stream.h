@@ -23,11 +23,18 @@
 
 #include "../inc/MarlinConfig.h"
 
+#ifndef BINARY_STREAM_WRITE_BLOCKS
+  #define BINARY_STREAM_WRITE_BLOCKS 1
+#endif
+
+// Received data is staged here and written to the media as whole blocks.
+// Compressed data is decoded straight into it, so it's the only data buffer either way.
+// STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
+static __attribute__((aligned(sizeof(size_t)))) uint8_t stage_buffer[512 * (BINARY_STREAM_WRITE_BLOCKS)] = {};
+
 #define BINARY_STREAM_COMPRESSION
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   #include "../libs/heatshrink/heatshrink_decoder.h"
-  // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
-  static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[512] = {};
   static heatshrink_decoder hsd;
 #endif
 
@@ -52,6 +59,7 @@ private:
       }
       bool compression_enabled() { return compression & 0x1; }
       bool dummy_transfer() { return dummy & 0x1; }
+      bool resume_transfer() { return dummy & 0x2; }
       static char* filename() { return data; }
       private:
         uint8_t dummy, compression;
@@ -59,18 +67,50 @@ private:
     };
   };
 
-  static bool file_open(char *filename) {
+  static bool file_open(char *filename, const bool resume) {
+    resume_offset = 0;
     if (!dummy_transfer) {
       card.mount();
-      card.openFileWrite(filename);
+      card.openFileWrite(filename, resume);
       if (!card.isFileOpen()) return false;
+      if (resume) resume_offset = card.getWriteSize();
     }
     transfer_active = true;
     data_waiting = 0;
+    // Fill only up to the next block boundary first, so later writes are block-aligned
+    stage_size = sizeof(stage_buffer) - (resume_offset & 0x1FF);
     TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_reset(&hsd));
     return true;
   }
 
+  // Write the staged data, with as few multiple-block writes as the clusters allow
+  static bool flush_data() {
+    if (!dummy_transfer) {
+      size_t done = 0;
+      for (int16_t n; data_waiting - done >= 512; done += n << 9)
+        if ((n = card.writeBlocks(&stage_buffer[done], (data_waiting - done) >> 9)) <= 0) {
+          if (n < 0) return false;
+          break;
+        }
+      if (done < data_waiting && card.write(&stage_buffer[done], data_waiting - done) < 0) return false;
+    }
+    data_waiting = 0;
+    stage_size = sizeof(stage_buffer);
+    return true;
+  }
+
+  static bool stage_data(const char *src, size_t length) {
+    while (length) {
+      const size_t n = _MIN(length, stage_size - data_waiting);
+      memcpy(&stage_buffer[data_waiting], src, n);
+      data_waiting += n;
+      src += n;
+      length -= n;
+      if (data_waiting == stage_size && !flush_data()) return false;
+    }
+    return true;
+  }
+
   static bool file_write(char *buffer, const size_t length) {
     #if ENABLED(BINARY_STREAM_COMPRESSION)
       if (compression) {
@@ -81,32 +121,21 @@ private:
           heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
           total_processed += processed_count;
           do {
-            presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
+            presult = heatshrink_decoder_poll(&hsd, &stage_buffer[data_waiting], stage_size - data_waiting, &processed_count);
             data_waiting += processed_count;
-            if (data_waiting == sizeof(decode_buffer)) {
-              if (!dummy_transfer)
-                if (card.write(decode_buffer, data_waiting) < 0) {
-                  return false;
-                }
-              data_waiting = 0;
-            }
+            if (data_waiting == stage_size && !flush_data()) return false;
           } while (presult == HSDR_POLL_MORE);
         }
         return true;
       }
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
+    return stage_data(buffer, length);
   }
 
   static bool file_close() {
     if (!dummy_transfer) {
-      #if ENABLED(BINARY_STREAM_COMPRESSION)
-        // flush any buffered data
-        if (data_waiting) {
-          if (card.write(decode_buffer, data_waiting) < 0) return false;
-          data_waiting = 0;
-        }
-      #endif
+      // flush any buffered data
+      if (data_waiting && !flush_data()) return false;
       card.closefile();
       card.release();
     }
@@ -128,17 +157,19 @@ private:
 
   enum class FileTransfer : uint8_t { QUERY, OPEN, CLOSE, WRITE, ABORT };
 
-  static size_t data_waiting, transfer_timeout, idle_timeout;
+  static size_t data_waiting, stage_size, transfer_timeout, idle_timeout;
+  static uint32_t resume_offset;
   static bool transfer_active, dummy_transfer, compression;
 
 public:
 
   static void idle() {
-    // If a transfer is interrupted and a file is left open, abort it after 'idle_period' ms
+    // If a transfer is interrupted and a file is left open, close it after 'idle_period' ms.
+    // The data received so far is kept so the host can resume the transfer.
     const millis_t ms = millis();
     if (transfer_active && ELAPSED(ms, idle_timeout)) {
       idle_timeout = ms + idle_period;
-      if (ELAPSED(ms, transfer_timeout)) transfer_abort();
+      if (ELAPSED(ms, transfer_timeout)) file_close();
     }
   }
 
@@ -161,8 +192,11 @@ public:
             auto packet = Packet::Open::decode(buffer);
             compression = packet.compression_enabled();
             dummy_transfer = packet.dummy_transfer();
-            if (file_open(packet.filename())) {
-              SERIAL_ECHOLNPGM("PFT:success");
+            if (file_open(packet.filename(), packet.resume_transfer())) {
+              if (packet.resume_transfer())
+                SERIAL_ECHOLNPGM("PFT:success:", resume_offset);
+              else
+                SERIAL_ECHOLNPGM("PFT:success");
               break;
             }
           }
@@ -194,7 +228,7 @@ public:
     }
   }
 
-  static const uint16_t version_major = 0, version_minor = 1, version_patch = 0, timeout = 10000, idle_period = 1000;
+  static const uint16_t version_major = 0, version_minor = 2, version_patch = 0, timeout = 10000, idle_period = 1000;
 };
 
 class BinaryStream {
@@ -336,7 +370,7 @@ public:
                 else
                   stream_state = StreamState::PACKET_PROCESS;
               }
-              else if (packet.header.sync == sync - 1) {           // ok response must have been lost
+              else if (uint8_t(sync - packet.header.sync) <= max_window) { // Already received, so its ok response must have been lost
                 SERIAL_ECHOLNPGM("ok", packet.header.sync);  // transmit valid packet received and drop the payload
                 stream_state = StreamState::PACKET_RESET;
               }
@@ -446,7 +480,10 @@ public:
     SDFileTransferProtocol::idle();
   }
 
-  static const uint16_t packet_max_wait = 500, rx_timeslice = 20, max_retries = 0, version_major = 0, version_minor = 1, version_patch = 0;
+  // Packets the host may send ahead of the last ok (version 0.2 and up)
+  static const uint8_t max_window = 16;
+
+  static const uint16_t packet_max_wait = 500, rx_timeslice = 20, max_retries = 0, version_major = 0, version_minor = 2, version_patch = 0;
   uint8_t  packet_retries, sync;
   uint16_t buffer_next_index;
   uint32_t bytes_received;
@@ -27,16 +27,19 @@
 #include "cancel_object.h"
 #include "../gcode/gcode.h"
 #include "../lcd/marlinui.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
 
 CancelObject cancelable;
 
 cancel_state_t CancelObject::state;
+bool CancelObject::e_skipped; // = false
 
 void CancelObject::set_active_object(const int8_t obj) {
   state.active_object = obj;
-  if (WITHIN(obj, 0, 31)) {
+  if (WITHIN(obj, 0, CANCEL_OBJECTS_MAX - 1)) {
     if (obj >= state.object_count) state.object_count = obj + 1;
-    state.skipping = TEST(state.canceled, obj);
+    state.skipping = state.canceled.test(obj);
   }
   else
     state.skipping = false;
@@ -49,30 +52,68 @@ void CancelObject::set_active_object(const int8_t obj) {
   #endif
 }
 
+void CancelObject::set_object_count(const int count) {
+  reset();
+  if (count > CANCEL_OBJECTS_MAX)
+    SERIAL_ECHO_MSG("Only the first ", CANCEL_OBJECTS_MAX, " objects can be canceled.");
+  state.object_count = _MIN(count, CANCEL_OBJECTS_MAX);
+}
+
 void CancelObject::cancel_object(const int8_t obj) {
-  if (WITHIN(obj, 0, 31)) {
-    SBI(state.canceled, obj);
+  if (WITHIN(obj, 0, CANCEL_OBJECTS_MAX - 1)) {
+    state.canceled.set(obj);
     if (obj == state.active_object) state.skipping = true;
   }
 }
 
 void CancelObject::uncancel_object(const int8_t obj) {
-  if (WITHIN(obj, 0, 31)) {
-    CBI(state.canceled, obj);
+  if (WITHIN(obj, 0, CANCEL_OBJECTS_MAX - 1)) {
+    state.canceled.clear(obj);
     if (obj == state.active_object) state.skipping = false;
   }
 }
 
+/**
+ * Drop a move in a canceled object before it is planned, keeping only
+ * the feedrate and the logical E position so the next printed move
+ * neither extrudes the skipped filament nor loses its F.
+ * The planner E position is brought up to date once by sync_e().
+ */
+bool CancelObject::skip_move() {
+  if (parser.command_letter != 'G') return false;
+  switch (parser.codenum) {
+    case 0: case 1: TERN_(ARC_SUPPORT, case 2: case 3:) TERN_(BEZIER_CURVE_SUPPORT, case 5:) break;
+    default: return false;
+  }
+
+  if (parser.floatval('F') > 0) feedrate_mm_s = MMM_TO_MMS(parser.value_linear_units());
+
+  #if HAS_EXTRUDERS
+    if (parser.seenval('E')) {
+      const float v = parser.value_axis_units(E_AXIS);
+      current_position.e = gcode.axis_is_relative(E_AXIS) ? current_position.e + v : v;
+      e_skipped = true;
+    }
+  #endif
+
+  return true;
+}
+
+void CancelObject::resync_e() {
+  e_skipped = false;
+  TERN_(HAS_EXTRUDERS, planner.set_e_position_mm(current_position.e));
+}
+
 void CancelObject::report() {
   if (state.active_object >= 0)
     SERIAL_ECHO_MSG("Active Object: ", state.active_object);
 
-  if (state.canceled == 0x0000) return;
+  if (!state.canceled) return;
 
   SERIAL_ECHO_START();
   SERIAL_ECHOPGM("Canceled:");
   for (int i = 0; i < state.object_count; i++)
-    if (TEST(state.canceled, i)) SERIAL_ECHO(C(' '), i);
+    if (state.canceled.test(i)) SERIAL_ECHO(C(' '), i);
   SERIAL_EOL();
 }
 
@@ -21,25 +21,34 @@
  */
 #pragma once
 
-#include <stdint.h>
+#include "../inc/MarlinConfig.h"
 
 typedef struct CancelState {
   bool skipping = false;
   int8_t object_count = 0, active_object = 0;
-  uint32_t canceled = 0x0000;
+  Flags<CANCEL_OBJECTS_MAX> canceled{};
 } cancel_state_t;
 
 class CancelObject {
 public:
   static cancel_state_t state;
   static void set_active_object(const int8_t obj=state.active_object);
+  static void set_object_count(const int count);
   static void cancel_object(const int8_t obj);
   static void uncancel_object(const int8_t obj);
   static void report();
-  static bool is_canceled(const int8_t obj) { return TEST(state.canceled, obj); }
+  static bool is_canceled(const int8_t obj) { return WITHIN(obj, 0, CANCEL_OBJECTS_MAX - 1) && state.canceled.test(obj); }
   static void clear_active_object() { set_active_object(-1); }
   static void cancel_active_object() { cancel_object(state.active_object); }
-  static void reset() { state.canceled = 0x0000; state.object_count = 0; clear_active_object(); }
+  static void reset() { state.canceled.reset(); state.object_count = 0; clear_active_object(); }
+
+  // Drop a parsed move while skipping. Call sync_e before anything else runs.
+  static bool skip_move();
+  static void sync_e() { if (e_skipped) resync_e(); }
+
+private:
+  static bool e_skipped;
+  static void resync_e();
 };
 
 extern CancelObject cancelable;
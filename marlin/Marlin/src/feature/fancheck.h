@@ -66,6 +66,7 @@ class FanCheck {
     static void update_tachometers();
     static void compute_speed(uint16_t elapsedTime);
     static void print_fan_states();
+    static uint8_t get_rps(const uint8_t f) { return rps[f]; }
     #if HAS_PWMFANCHECK
       static void toggle_measuring() { FLIP(measuring); }
       static bool is_measuring() { return measuring; }
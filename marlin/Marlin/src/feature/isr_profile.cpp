@@ -0,0 +1,106 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+
+#include "isr_profile.h"
+#include "../module/stepper.h"
+
+ISRProfile isr_profile;
+
+isr_phase_stats_t ISRProfile::stats[ISR_PHASES];
+millis_t ISRProfile::since;
+
+static constexpr float us_per_count = 1000000.0f / (ISR_PROFILE_RATE);
+
+void ISRProfile::reset() {
+  const bool was_on = stepper.suspend();
+  ZERO(stats);
+  since = millis();
+  if (was_on) stepper.wake_up();
+}
+
+// Estimate the 99th percentile by interpolating within its histogram bucket
+static float p99(const isr_phase_stats_t &s) {
+  uint32_t total = 0;
+  for (const auto h : s.hist) total += h;
+  if (!total) return 0;
+
+  const uint32_t target = total - total / 100;
+  uint32_t cum = 0;
+  for (uint8_t b = 0; b < ISR_PROFILE_BUCKETS; ++b) {
+    if (!s.hist[b]) continue;
+    if (cum + s.hist[b] >= target) {
+      const uint32_t lo = b ? _BV32(b - 1) : 0,
+                     hi = b < ISR_PROFILE_BUCKETS - 1 ? _BV32(b) : s.max + 1;
+      return _MIN(lo + float(hi - lo) * (target - cum) / s.hist[b], float(s.max));
+    }
+    cum += s.hist[b];
+  }
+  return s.max;
+}
+
+static FSTR_P phase_name(const ISRPhase p) {
+  switch (p) {
+    default:
+    case ISR_TOTAL:   return F("total");
+    case ISR_PULSE:   return F("pulse");
+    case ISR_BLOCK:   return F("block");
+    #if ENABLED(LIN_ADVANCE)
+      case ISR_ADVANCE: return F("advance");
+    #endif
+    #if HAS_ZV_SHAPING
+      case ISR_SHAPING: return F("shaping");
+    #endif
+  }
+}
+
+void ISRProfile::report() {
+  const float elapsed_s = (millis() - since) * 0.001f;
+
+  for (uint8_t p = 0; p < ISR_PHASES; ++p) {
+    // Take a consistent copy of one phase at a time
+    const bool was_on = stepper.suspend();
+    const isr_phase_stats_t s = stats[p];
+    if (was_on) stepper.wake_up();
+
+    if (p == ISR_TOTAL)
+      SERIAL_ECHOLNPGM("Stepper ISR: ", s.count, " calls in ", p_float_t(elapsed_s, 1), "s, CPU ",
+        p_float_t(elapsed_s > 0 ? s.sum * us_per_count * 0.0001f / elapsed_s : 0, 1), "%");
+
+    SERIAL_ECHO(phase_name(ISRPhase(p)));
+    if (s.count)
+      SERIAL_ECHOLNPGM(
+        " n:", s.count,
+        " min:", p_float_t(s.min * us_per_count, 2),
+        " avg:", p_float_t(float(s.sum) / s.count * us_per_count, 2),
+        " p99:", p_float_t(p99(s) * us_per_count, 2),
+        " max:", p_float_t(s.max * us_per_count, 2), " us"
+      );
+    else
+      SERIAL_ECHOLNPGM(" n:0");
+  }
+}
+
+#endif // STEPPER_ISR_PROFILE
@@ -0,0 +1,96 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Stepper ISR profiling (STEPPER_ISR_PROFILE)
+ *
+ * Time each phase of the stepper ISR with the finest counter the HAL has:
+ *  - LINUX : The simulated Clock, counted at F_CPU
+ *  - ARM   : The DWT cycle counter on Cortex-M3/M4/M7, counted at F_CPU
+ *  - Other : The stepper timer itself, counted at STEPPER_TIMER_RATE
+ *
+ * Each phase keeps min/max/sum and a log2 histogram, from which M579 can
+ * estimate the 99th percentile. The total ISR time over the elapsed time
+ * gives the fraction of the CPU used by stepping.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if defined(__PLAT_LINUX__)
+  #define ISR_PROFILE_RATE      (F_CPU)
+  #define ISR_PROFILE_COUNT()   uint32_t(Clock::ticks(F_CPU))
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+  #define ISR_PROFILE_RATE      (F_CPU)
+  #define ISR_PROFILE_COUNT()   (*(volatile uint32_t *)0xE0001004) // DWT_CYCCNT, enabled by calibrate_delay_loop()
+#else
+  #define ISR_PROFILE_RATE      (STEPPER_TIMER_RATE)
+  #define ISR_PROFILE_COUNT()   uint32_t(HAL_timer_get_count(MF_TIMER_STEP))
+#endif
+
+#define ISR_PROFILE_BUCKETS 16
+
+enum ISRPhase : uint8_t {
+  ISR_TOTAL, ISR_PULSE, ISR_BLOCK,
+  OPTITEM(LIN_ADVANCE, ISR_ADVANCE)
+  OPTITEM(HAS_ZV_SHAPING, ISR_SHAPING)
+  ISR_PHASES
+};
+
+typedef struct {
+  uint32_t count, min, max;
+  uint64_t sum;
+  uint16_t hist[ISR_PROFILE_BUCKETS]; // Bucket n holds times in [2^(n-1), 2^n)
+} isr_phase_stats_t;
+
+class ISRProfile {
+public:
+  static isr_phase_stats_t stats[ISR_PHASES];
+  static millis_t since;
+
+  // Record one run of a phase, given the count at its start
+  static void record(const ISRPhase p, const uint32_t start) {
+    const uint32_t t = ISR_PROFILE_COUNT() - start;
+    isr_phase_stats_t &s = stats[p];
+    if (!s.count++ || t < s.min) s.min = t;
+    if (t > s.max) s.max = t;
+    s.sum += t;
+    uint8_t b = t ? sizeof(unsigned long) * 8 - __builtin_clzl(t) : 0; // Significant bits
+    NOMORE(b, ISR_PROFILE_BUCKETS - 1);
+    if (++s.hist[b] == UINT16_MAX) for (auto &h : s.hist) h >>= 1; // Keep the shape, drop older weight
+  }
+
+  // Time a phase for the lifetime of a local
+  class Probe {
+  public:
+    Probe(const ISRPhase p) : phase(p), start(ISR_PROFILE_COUNT()) {}
+    ~Probe() { ISRProfile::record(phase, start); }
+  private:
+    const ISRPhase phase;
+    const uint32_t start;
+  };
+
+  static void reset();
+  static void report();
+};
+
+extern ISRProfile isr_profile;
@@ -0,0 +1,80 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include "laser_raster.h"
+#include "../module/planner.h"
+#include "../MarlinCore.h"
+
+LaserRaster laser_raster;
+
+uint8_t LaserRaster::pixels[LASER_RASTER_BUFFERS][LASER_RASTER_PIXELS];
+uint16_t LaserRaster::pending; // = 0
+volatile uint8_t LaserRaster::head, LaserRaster::tail; // = 0
+
+uint8_t* LaserRaster::claim() {
+  // The head buffer is free when it's not the last one before the tail
+  while (next(head) == tail) idle();
+  pending = 0;
+  return pixels[head];
+}
+
+void LaserRaster::attach(block_t * const block) {
+  block->laser.raster_count = pending;
+  if (pending) {
+    block->laser.raster_buffer = head;
+    head = next(head);
+    pending = 0;
+  }
+}
+
+int16_t LaserRaster::decode(const char *in, uint8_t *out, const uint16_t size) {
+  auto value = [](const char c) -> int8_t {
+    if (WITHIN(c, 'A', 'Z')) return c - 'A';
+    if (WITHIN(c, 'a', 'z')) return c - 'a' + 26;
+    if (WITHIN(c, '0', '9')) return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+  };
+
+  uint16_t count = 0;
+  uint32_t bits = 0;
+  uint8_t nbits = 0;
+  for (; *in && *in != ' ' && *in != '='; ++in) {
+    const int8_t v = value(*in);
+    if (v < 0) return -1;
+    bits = (bits << 6) | v;
+    nbits += 6;
+    if (nbits >= 8) {
+      if (count >= size) return -1;
+      nbits -= 8;
+      out[count++] = bits >> nbits;
+    }
+  }
+  return count;
+}
+
+#endif // LASER_RASTER
@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Laser raster engraving (G7)
+ *
+ * A G7 carries the pixels for one straight move. They are decoded into one
+ * of LASER_RASTER_BUFFERS pixel buffers, which is attached to the planner
+ * block for the move. The stepper ISR spreads the pixels evenly over the
+ * block's step events and sets the laser power for each one in turn.
+ *
+ * Buffers are used in the same order as the planner blocks, so they're kept
+ * in a ring that's filled by G7 and freed as the stepper finishes blocks.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../module/planner.h"
+
+class LaserRaster {
+public:
+  static uint8_t pixels[LASER_RASTER_BUFFERS][LASER_RASTER_PIXELS];
+  static uint16_t pending;              // Pixels in the head buffer for the next block
+
+  // Get the head buffer to fill, waiting for one to be freed if needed
+  static uint8_t* claim();
+
+  // Give the pending pixels to a new planner block, or none
+  static void attach(block_t * const block);
+
+  // Free the oldest buffer. Called by the Stepper ISR when a raster block is done.
+  static void free() { if (tail != head) tail = next(tail); }
+
+  // Drop all buffers along with the planner queue
+  static void reset() { tail = head; pending = 0; }
+
+  // Decode base64 into 'out'. Return the number of bytes, or -1 on bad data or overflow.
+  static int16_t decode(const char *in, uint8_t *out, const uint16_t size);
+
+private:
+  static volatile uint8_t head, tail;   // Next buffer to fill, oldest buffer in use
+  static uint8_t next(const uint8_t i) { return (i + 1) % (LASER_RASTER_BUFFERS); }
+};
+
+extern LaserRaster laser_raster;
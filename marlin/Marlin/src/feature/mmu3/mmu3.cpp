@@ -252,11 +252,11 @@ namespace MMU3 {
     unsigned char e_active = 0;
     block_t *block;
     if (planner.block_buffer_tail != planner.block_buffer_head) {
-      uint8_t block_index = planner.block_buffer_tail;
+      block_index_t block_index = planner.block_buffer_tail;
       while (block_index != planner.block_buffer_head) {
         block = &planner.block_buffer[block_index];
         if (block->steps[E_AXIS] != 0) e_active++;
-        block_index = (block_index + 1) & (BLOCK_BUFFER_SIZE - 1);
+        block_index = block_inc_mod(block_index, 1);
       }
     }
     return (e_active > 0);
@@ -623,7 +623,7 @@ void PrintJobRecovery::resume() {
           const cancel_state_t cs = info.cancel_state;
           DEBUG_ECHOPGM("Canceled:");
           for (int i = 0; i < cs.object_count; i++)
-            if (TEST(cs.canceled, i)) { DEBUG_CHAR(' '); DEBUG_ECHO(i); }
+            if (cs.canceled.test(i)) { DEBUG_CHAR(' '); DEBUG_ECHO(i); }
           DEBUG_EOL();
         #endif
 
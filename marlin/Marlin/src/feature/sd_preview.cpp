@@ -0,0 +1,446 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * sd_preview.cpp - Preview of the moves ahead in the file being printed
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_MOVE_PREVIEW)
+
+#include "sd_preview.h"
+#include "../sd/cardreader.h"
+#include "../module/planner.h"
+#include "../gcode/gcode.h"
+#include "../gcode/queue.h"
+
+SDPreview sd_preview;
+
+uint32_t SDPreview::cmd_end, SDPreview::line_end[BUFSIZE];
+SDPreview::move_t SDPreview::moves[SD_PREVIEW_MOVES];
+uint8_t SDPreview::head, SDPreview::count, SDPreview::running;
+bool SDPreview::active, SDPreview::dirty;
+uint32_t SDPreview::exit_end;
+float SDPreview::exit_sqr;
+
+enum PreviewAxis : uint8_t { PX, PY, PZ, PE, PN };
+
+// The line scanner, running ahead of the command queue
+static uint32_t scan_pos;         // File position of the next byte to scan
+static char line[MAX_CMD_SIZE];   // As long as the queue allows
+static uint8_t line_len;
+static bool line_long,            // The line didn't fit, or the scan started in the middle of it
+            in_comment;
+
+// Modal state of the file at the scan position
+static float pos[PN];             // Logical position, NAN where unknown
+static bool rel_xyz, rel_e, inches;
+static feedRate_t feedrate;       // (mm/s) 0 where unknown
+
+// The previous line, if it was a move
+static bool prev_move;
+static float prev_unit[PN], prev_cap;
+
+// A letter as the G-code parser sees it
+static char gcode_letter(const char c) {
+  return TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')) ? c + 'A' - 'a' : c;
+}
+
+static void normalize(float (&v)[PN]) {
+  float mag = 0;
+  for (uint8_t i = 0; i < PN; ++i) mag += sq(v[i]);
+  mag = RSQRT(mag);
+  for (uint8_t i = 0; i < PN; ++i) v[i] *= mag;
+}
+
+#if HAS_JUNCTION_DEVIATION
+  // The planner includes E in the direction of moves that extrude
+  static void junction_vector(float (&v)[PN], const float (&unit)[PN]) {
+    for (uint8_t i = 0; i < PN; ++i) v[i] = unit[i];
+    if (unit[PE]) normalize(v);
+  }
+#endif
+
+// Read a number the way the G-code parser does, where E or X ends it
+static bool read_number(char *&s, float &v) {
+  char *e = s;
+  while (*e && *e != ' ' && *e != '\t' && *e != '*' && !WITHIN(*e | 0x20, 'a', 'z')) e++;
+  if (e == s) return false;
+  const char c = *e;
+  *e = '\0';
+  char *end;
+  v = strtof(s, &end);
+  *e = c;
+  const bool ok = end == e;
+  s = e;
+  return ok;
+}
+
+void SDPreview::reset() {
+  head = count = 0;
+  active = false;
+
+  scan_pos = card.getIndex();
+  line_len = 0;
+  line_long = in_comment = false;
+
+  for (uint8_t i = 0; i < PN; ++i) pos[i] = NAN;
+  rel_xyz = gcode.axis_is_relative(X_AXIS);
+  rel_e = TERN0(HAS_EXTRUDERS, gcode.axis_is_relative(E_AXIS));
+  inches = TERN0(INCH_MODE_SUPPORT, parser.linear_unit_factor != 1.0f);
+  feedrate = 0;
+  prev_move = false;
+}
+
+void SDPreview::add(const move_t &m) {
+  uint8_t i = head + count;
+  if (i >= SD_PREVIEW_MOVES) i -= SD_PREVIEW_MOVES;
+  moves[i] = m;
+  count++;
+  dirty = true;
+}
+
+/**
+ * Scan the file data waiting in the read-ahead ring, one line at a time.
+ * Stop when the ring runs out or the move list is full.
+ */
+void SDPreview::scan() {
+  if (!card.isStillFetching()) return;
+
+  while (count < SD_PREVIEW_MOVES) {
+    // The queue read past the scan, e.g., after a jump in the file
+    if (scan_pos < card.getIndex()) {
+      reset();
+      line_long = true;   // Ignore the rest of the current line
+    }
+
+    uint16_t n;
+    const uint8_t *data = card.readahead_peek(scan_pos, n);
+
+    if (!data) {
+      // A last line with no newline
+      if (scan_pos >= card.getFileSize() && (line_len || line_long)) {
+        line[line_len] = '\0';
+        parse_line(line_long ? nullptr : line, scan_pos);
+        line_len = 0;
+        line_long = in_comment = false;
+      }
+      break;
+    }
+
+    for (; n && count < SD_PREVIEW_MOVES; --n) {
+      const char c = *data++;
+      scan_pos++;
+      if (ISEOL(c)) {
+        line[line_len] = '\0';
+        parse_line(line_long ? nullptr : line, scan_pos);
+        line_len = 0;
+        line_long = in_comment = false;
+      }
+      else if (in_comment || c == ';')
+        in_comment = true;
+      else if (line_len < sizeof(line) - 1)
+        line[line_len++] = c;
+      else
+        line_long = true;
+    }
+  }
+}
+
+/**
+ * A command from the queue starts running. Drop the moves before it,
+ * and if it's the first previewed move keep that as the current one.
+ */
+void SDPreview::start_line(const uint8_t index_r) {
+  active = false;
+  running = index_r;
+  const uint32_t pos = line_end[index_r];
+  if (!pos) return;
+
+  bool popped = false;
+  while (count && moves[head].end_pos < pos) {
+    if (++head >= SD_PREVIEW_MOVES) head = 0;
+    count--;
+    popped = true;
+  }
+
+  if (count && moves[head].end_pos == pos && moves[head].feedrate) {
+    active = true;
+    dirty = true;
+  }
+
+  if (popped) scan();
+}
+
+/**
+ * The file position after the SD commands that follow the running one
+ * in the queue, up to the first command from another source.
+ */
+uint32_t SDPreview::queued_end() {
+  uint32_t end_pos = 0;
+  uint8_t i = running;
+  for (uint8_t n = queue.ring_buffer.length; n > 1; --n) {
+    if (++i >= BUFSIZE) i = 0;
+    if (!line_end[i]) break;
+    end_pos = line_end[i];
+  }
+  return end_pos;
+}
+
+float SDPreview::exit_speed_sqr() {
+  // Injected commands run before the rest of the queue
+  if (!active || !card.isStillPrinting() || queue.injected_commands_P || queue.injected_commands[0]) return 0;
+
+  const uint32_t end_pos = queued_end();
+  if (dirty || end_pos != exit_end) plan_exit(end_pos);
+  return exit_sqr;
+}
+
+void SDPreview::interrupt() { planner.plan_tail_stop(); }
+
+/**
+ * Find the exit speed of the current move by a reverse pass over the
+ * queued moves after it, starting from a stop after the last one.
+ */
+void SDPreview::plan_exit(const uint32_t end_pos) {
+  uint8_t last = 0;
+  while (last + 1 < count) {
+    uint8_t i = head + last + 1;
+    if (i >= SD_PREVIEW_MOVES) i -= SD_PREVIEW_MOVES;
+    if (moves[i].end_pos > end_pos) break;
+    last++;
+  }
+
+  float v_sqr = 0;
+  for (uint8_t n = last + 1; --n;) {
+    uint8_t i = head + n, p = i - 1;
+    if (i >= SD_PREVIEW_MOVES) i -= SD_PREVIEW_MOVES;
+    if (p >= SD_PREVIEW_MOVES) p -= SD_PREVIEW_MOVES;
+    const move_t &m = moves[i];
+    v_sqr = _MIN(m.entry_sqr, v_sqr + m.brake_sqr,
+                 sq(MMS_SCALED(m.feedrate)), sq(MMS_SCALED(moves[p].feedrate)));
+  }
+  exit_sqr = v_sqr;
+  exit_end = end_pos;
+  dirty = false;
+}
+
+/**
+ * Parse one line of the file. Moves get their limits, commands that only
+ * change the coordinate modes update the scanner, and anything else is
+ * a stop. A null line is one that couldn't be read in full.
+ */
+void SDPreview::parse_line(char *s, const uint32_t end_pos) {
+  move_t m = { end_pos, 0, 0, 0 };
+
+  // A stop that also forgets the position, for anything unknown
+  auto stop = [&]{
+    for (uint8_t i = 0; i < PN; ++i) pos[i] = NAN;
+    prev_move = false;
+    add(m);
+  };
+
+  if (!s) return stop();
+
+  while (*s == ' ' || *s == '\t') s++;
+  if (gcode_letter(*s) == 'N') {                    // Skip a line number
+    do s++; while (NUMERIC(*s));
+    while (*s == ' ' || *s == '\t') s++;
+  }
+  if (!*s || *s == '*') return;                     // Nothing left to run
+
+  const char letter = gcode_letter(*s);
+  if (!NUMERIC(s[1])) return stop();
+  const int code = strtol(s + 1, &s, 10);
+  if (*s == '.') return stop();                     // No subcodes
+
+  if (letter == 'M') {
+    switch (code) {
+      case 82: rel_e = false; return;
+      case 83: rel_e = true; return;
+      case 73: case 106: case 107: case 117: return; // Don't affect motion
+      default: return stop();
+    }
+  }
+
+  if (letter != 'G') return stop();
+
+  // Read the axis words of the command
+  float val[PN];
+  bool has[PN] = { false };
+  for (;;) {
+    while (*s == ' ' || *s == '\t') s++;
+    if (!*s || *s == '*') break;                    // End or checksum
+    const char w = gcode_letter(*s++);
+    float v;
+    if (!read_number(s, v)) return stop();
+    switch (w) {
+      case 'X': has[PX] = true; val[PX] = v; break;
+      case 'Y': has[PY] = true; val[PY] = v; break;
+      case 'Z': has[PZ] = true; val[PZ] = v; break;
+      case 'E': if (ENABLED(HAS_EXTRUDERS)) { has[PE] = true; val[PE] = v; } break;
+      case 'F': if (code > 1) return stop(); if (v > 0) feedrate = MMM_TO_MMS(v); break;
+      default: return stop();
+    }
+  }
+
+  switch (code) {
+    case 0: if (ENABLED(VARIABLE_G0_FEEDRATE)) return stop(); break;
+    case 1: break;
+    case 20: inches = true; return stop();
+    case 21: inches = false; return;
+    case 90: rel_xyz = rel_e = false; return;
+    case 91: rel_xyz = rel_e = true; return;
+    case 92:
+      if (inches || !(has[PX] || has[PY] || has[PZ] || has[PE])) return stop();
+      for (uint8_t i = 0; i < PN; ++i) if (has[i]) pos[i] = val[i];
+      return;
+    default: return stop();
+  }
+
+  if (inches) return stop();
+
+  // The move in each axis, from the previous position
+  float d[PN] = { 0 };
+  for (uint8_t i = 0; i < PN; ++i) if (has[i]) {
+    const float to = (i == PE ? rel_e : rel_xyz) ? pos[i] + val[i] : val[i];
+    d[i] = to - pos[i];
+    pos[i] = to;
+  }
+  // Relative moves from an unknown position know only their direction
+  for (uint8_t i = 0; i < PN; ++i) if (has[i] && isnan(d[i])) d[i] = (i == PE ? rel_e : rel_xyz) ? val[i] : NAN;
+
+  // DRYRUN drops E from every move, so the planner uses the travel acceleration
+  if (DEBUGGING(DRYRUN)) d[PE] = 0;
+
+  // A move from an unknown position is a stop, but it makes the position known
+  if (isnan(d[PX]) || isnan(d[PY]) || isnan(d[PZ]) || isnan(d[PE])) {
+    prev_move = false;
+    return add(m);
+  }
+
+  // A move the planner would drop doesn't change anything
+  const float steps = _MAX(ABS(d[PX]) * planner.settings.axis_steps_per_mm[X_AXIS],
+                           ABS(d[PY]) * planner.settings.axis_steps_per_mm[Y_AXIS],
+                           ABS(d[PZ]) * planner.settings.axis_steps_per_mm[Z_AXIS],
+                           TERN0(HAS_EXTRUDERS, ABS(d[PE]) * planner.settings.axis_steps_per_mm[E_AXIS_N(active_extruder)]));
+  if (!steps) return;
+
+  const float mm = SQRT(sq(d[PX]) + sq(d[PY]) + sq(d[PZ]));
+
+  // E-only moves and moves short enough to be merged end the preview
+  if (!feedrate || !mm || steps < (MIN_STEPS_PER_SEGMENT) + 1) {
+    prev_move = false;
+    return add(m);
+  }
+
+  // Per mm of the move in each axis
+  const float inv_mm = 1.0f / mm;
+  float unit[PN];
+  for (uint8_t i = 0; i < PN; ++i) unit[i] = d[i] * inv_mm;
+
+  // Axis limits on the speed and acceleration of the whole move
+  const AxisEnum axis[PN] = { X_AXIS, Y_AXIS, Z_AXIS, TERN(HAS_EXTRUDERS, AxisEnum(E_AXIS_N(active_extruder)), NO_AXIS_ENUM) };
+  float cap = __FLT_MAX__,
+        accel = d[PE] ? planner.settings.acceleration : planner.settings.travel_acceleration;
+  for (uint8_t i = 0; i < PN; ++i) if (unit[i] && (i != PE || ENABLED(HAS_EXTRUDERS))) {
+    const float u = ABS(unit[i]);
+    NOMORE(cap, planner.settings.max_feedrate_mm_s[axis[i]] / u);
+    NOMORE(accel, planner.settings.max_acceleration_mm_per_s2[axis[i]] / u);
+  }
+
+  #if ENABLED(SLOWDOWN)
+    // The speed if the planner slows the move down as much as it can
+    if (planner.settings.min_segment_time_us)
+      NOMORE(cap, mm * 1000000.0f / planner.settings.min_segment_time_us);
+  #endif
+
+  #if HAS_ROUGH_LIN_ADVANCE
+    // Same limit as the planner puts on moves that use advance
+    const float k = planner.extruder_advance_K[E_INDEX_N(active_extruder)];
+    if (k && unit[PE] > 0 && unit[PE] <= 3.0f)
+      NOMORE(accel, TERN(HAS_LINEAR_E_JERK, planner.max_e_jerk[E_INDEX_N(active_extruder)], planner.max_jerk.e) / (k * unit[PE]));
+  #endif
+
+  m.feedrate = feedrate;
+  m.brake_sqr = 2 * accel * mm;
+
+  // Junction speed with the previous move. Never more than the planner will find.
+  if (prev_move) {
+    float junction_sqr;
+
+    #if HAS_JUNCTION_DEVIATION
+
+      float jv[PN];
+      junction_vector(jv, unit);
+
+      float cos_theta = 0;
+      for (uint8_t i = 0; i < PN; ++i) cos_theta -= prev_unit[i] * jv[i];
+
+      if (cos_theta > 0.999999f)
+        junction_sqr = 0;
+      else {
+        float ju[PN];
+        for (uint8_t i = 0; i < PN; ++i) ju[i] = jv[i] - prev_unit[i];
+        normalize(ju);
+        float junction_accel = accel;
+        for (uint8_t i = 0; i < PN; ++i) if (ju[i] && (i != PE || ENABLED(HAS_EXTRUDERS)))
+          NOMORE(junction_accel, planner.settings.max_acceleration_mm_per_s2[axis[i]] / ABS(ju[i]));
+
+        NOLESS(cos_theta, -0.999999f);
+        const float sin_theta_d2 = SQRT(0.5f * (1.0f - cos_theta));
+        junction_sqr = junction_accel * planner.junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+
+        #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
+          // The planner estimates the angle to within 0.033 radians
+          if (mm < 1 && cos_theta < -0.7071067812f)
+            NOMORE(junction_sqr, mm * junction_accel / (acosf(-cos_theta) + 0.034f));
+        #endif
+      }
+
+      for (uint8_t i = 0; i < PN; ++i) prev_unit[i] = jv[i];
+
+    #else // CLASSIC_JERK
+
+      // The speed at which no axis changes by more than its jerk
+      float junction = __FLT_MAX__;
+      for (uint8_t i = 0; i < PN; ++i) {
+        const float du = ABS(unit[i] - prev_unit[i]);
+        if (du) NOMORE(junction, planner.max_jerk[TERN_(HAS_EXTRUDERS, i == PE ? E_AXIS :) axis[i]] / du);
+      }
+      junction_sqr = sq(_MIN(junction, cap, prev_cap));
+      for (uint8_t i = 0; i < PN; ++i) prev_unit[i] = unit[i];
+
+    #endif
+
+    m.entry_sqr = _MIN(junction_sqr, sq(cap), sq(prev_cap));
+  }
+  else
+    TERN(HAS_JUNCTION_DEVIATION, junction_vector(prev_unit, unit), memcpy(prev_unit, unit, sizeof(unit)));
+
+  prev_move = true;
+  prev_cap = cap;
+  add(m);
+}
+
+#endif // SD_MOVE_PREVIEW
@@ -0,0 +1,90 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * sd_preview.h - Preview of the moves ahead in the file being printed
+ *
+ * The lines waiting in the SD read-ahead ring are scanned before they reach
+ * the command queue, and the G0/G1 moves among them are kept as a short list
+ * of speed limits. While one of these moves is being planned, the list acts
+ * as a virtual tail for the planner. The newest block may then end at the
+ * speed that the previewed moves can still brake from, instead of a speed
+ * from which it could stop on its own.
+ *
+ * Only moves already in the command queue, right after the running command,
+ * count. The planner is sure to get those next. Anything else ends the
+ * preview with a stop, so a change of settings, a dwell, or a tool change in
+ * the file is always planned as before. If an injected command will run first
+ * or the print pauses, the newest block is planned down to a stop again.
+ * A block that the stepper will take next always ends at a stop-safe speed,
+ * since the moves after it might not be planned before it ends.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class SDPreview {
+public:
+  // Limits of one previewed line
+  typedef struct {
+    uint32_t end_pos;   // File position after the line
+    float entry_sqr,    // Junction and axis limit on the entry speed², 0 for a stop
+          brake_sqr,    // Speed² shed by braking over the whole move (2 * a * length)
+          feedrate;     // Requested feedrate (mm/s) before M220 scaling, 0 for a stop
+  } move_t;
+
+  static uint32_t cmd_end;  // File position after the next command to commit
+
+  // Forget the file contents, e.g., when a file is opened or the position jumps
+  static void reset();
+
+  // Parse the lines that were newly read ahead
+  static void scan();
+
+  // Note the file position of the command being committed to the queue
+  static void commit(const uint8_t index_w) { line_end[index_w] = cmd_end; cmd_end = 0; }
+
+  // A command from the queue starts or finishes running
+  static void start_line(const uint8_t index_r);
+  static void end_line() { active = false; }
+
+  // Square of the speed at which the running move may end, or 0
+  static float exit_speed_sqr();
+
+  // The queued moves won't follow right away, so the planner has to be able to stop
+  static void interrupt();
+
+private:
+  static uint32_t line_end[BUFSIZE];
+  static move_t moves[SD_PREVIEW_MOVES];
+  static uint8_t head, count, running;
+  static bool active, dirty;
+  static uint32_t exit_end;
+  static float exit_sqr;
+
+  static void add(const move_t &m);
+  static void parse_line(char *s, const uint32_t end_pos);
+  static uint32_t queued_end();
+  static void plan_exit(const uint32_t end_pos);
+};
+
+extern SDPreview sd_preview;
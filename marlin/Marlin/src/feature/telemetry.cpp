@@ -0,0 +1,157 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * telemetry.cpp - Record samples for the host at a fixed rate
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TELEMETRY_RECORDER)
+
+#include "telemetry.h"
+#include "../module/temperature.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+#include "../libs/crc16.h"
+
+Telemetry telemetry;
+
+telemetry_sample_t Telemetry::samples[TELEMETRY_SAMPLES];
+volatile uint8_t Telemetry::head, Telemetry::count; // = 0
+volatile uint16_t Telemetry::seq; // = 0
+#if TELEMETRY_HEATERS
+  int16_t Telemetry::temps[TELEMETRY_HEATERS];
+#endif
+AutoReporter<Telemetry::AutoReport> Telemetry::auto_reporter;
+
+// Samples that fit in one frame after the sequence number
+static constexpr uint8_t frame_samples = _MIN(size_t(TELEMETRY_SAMPLES), (255 - 2) / sizeof(telemetry_sample_t));
+static_assert(frame_samples > 0, "TELEMETRY_RECORDER samples are too large for a frame.");
+
+// Temperature ISR calls per sample
+static constexpr uint16_t sample_ticks = _MAX(1, (TELEMETRY_INTERVAL) * (TEMP_TIMER_FREQUENCY) / 1000);
+
+// Reports have to keep up with the samples and leave the port room for everything else.
+// Each frame adds SYNC, LEN, SEQ and CRC to its samples. A byte takes 10 bits on the wire.
+static_assert((sizeof(telemetry_sample_t) + 6.0 / frame_samples) * 1000 / (TELEMETRY_INTERVAL) <= (BAUDRATE) / 10 / 2,
+  "TELEMETRY_INTERVAL is too short for BAUDRATE. Samples would come in faster than half the port can send them.");
+
+void Telemetry::update_temps() {
+  #if TELEMETRY_HEATERS
+    int16_t t[TELEMETRY_HEATERS];
+    TERN_(HAS_HOTEND, HOTEND_LOOP() t[e] = LROUND(thermalManager.degHotend(e) * 10));
+    TERN_(HAS_HEATED_BED, t[TELEMETRY_HEATERS - 1] = LROUND(thermalManager.degBed() * 10));
+
+    // The ISR must not see a half-written value
+    DISABLE_TEMPERATURE_INTERRUPT();
+    COPY(temps, t);
+    ENABLE_TEMPERATURE_INTERRUPT();
+  #endif
+}
+
+void Telemetry::isr() {
+  static uint16_t ticks = 0;
+  if (++ticks < sample_ticks) return;
+  ticks = 0;
+
+  telemetry_sample_t &s = samples[head];
+  s.ms = uint16_t(millis());
+  #if TELEMETRY_HEATERS
+    for (uint8_t h = 0; h < TELEMETRY_HEATERS; ++h) s.temp[h] = temps[h];
+    TERN_(HAS_HOTEND, HOTEND_LOOP() s.power[e] = thermalManager.temp_hotend[e].soft_pwm_amount);
+    TERN_(HAS_HEATED_BED, s.power[TELEMETRY_HEATERS - 1] = thermalManager.temp_bed.soft_pwm_amount);
+  #endif
+  s.planned = planner.movesplanned();
+  for (uint8_t a = 0; a < LOGICAL_AXES; ++a) s.steps[a] = stepper.position(AxisEnum(a));
+  #if HAS_FAN
+    FANS_LOOP(f) s.fan[f] = thermalManager.fan_speed[f];
+  #endif
+  #if TELEMETRY_TACHOS
+    for (uint8_t f = 0; f < TELEMETRY_TACHOS; ++f) s.rps[f] = fan_check.get_rps(f);
+  #endif
+
+  if (++head >= TELEMETRY_SAMPLES) head = 0;
+  if (count < TELEMETRY_SAMPLES) count++;
+  else seq++;                     // The oldest sample was overwritten
+}
+
+static void send_bytes(const void * const data, const uint8_t n, uint16_t &crc) {
+  const uint8_t *d = (const uint8_t *)data;
+  for (uint8_t i = 0; i < n; ++i) SERIAL_CHAR(char(d[i]));
+  crc16(&crc, d, n);
+}
+
+void Telemetry::report() {
+  // Send only the samples recorded so far. Newer ones wait for the next report,
+  // so a port slower than the ISR can't keep this from returning.
+  DISABLE_TEMPERATURE_INTERRUPT();
+  uint8_t left = count;
+  ENABLE_TEMPERATURE_INTERRUPT();
+
+  while (left) {
+    // Take a batch of samples, so the ISR can go on writing
+    telemetry_sample_t batch[frame_samples];
+    DISABLE_TEMPERATURE_INTERRUPT();
+    const uint8_t n = _MIN(count, frame_samples, left);
+    const uint16_t first = seq;
+    uint8_t i = (head + TELEMETRY_SAMPLES - count) % (TELEMETRY_SAMPLES);
+    for (uint8_t b = 0; b < n; ++b) {
+      batch[b] = samples[i];
+      if (++i >= TELEMETRY_SAMPLES) i = 0;
+    }
+    count -= n;
+    seq += n;
+    ENABLE_TEMPERATURE_INTERRUPT();
+    if (!n) break;
+    left -= n;
+
+    const uint8_t len = 2 + n * sizeof(telemetry_sample_t);
+    uint16_t crc = 0;
+    SERIAL_CHAR(char(TELEMETRY_SYNC));
+    send_bytes(&len, 1, crc);
+    send_bytes(&first, 2, crc);
+    send_bytes(batch, n * sizeof(telemetry_sample_t), crc);
+    SERIAL_CHAR(char(crc & 0xFF), char(crc >> 8));
+  }
+}
+
+void Telemetry::report_layout() {
+  SERIAL_ECHOLNPGM("TELEMETRY"
+    " size:", sizeof(telemetry_sample_t),
+    " interval:", TELEMETRY_INTERVAL,
+    " samples:", TELEMETRY_SAMPLES,
+    " heaters:", TELEMETRY_HEATERS,
+    " axes:", LOGICAL_AXES,
+    " fans:", FAN_COUNT,
+    " tachos:", TELEMETRY_TACHOS
+  );
+}
+
+void Telemetry::reset() {
+  DISABLE_TEMPERATURE_INTERRUPT();
+  seq += count;
+  count = 0;
+  ENABLE_TEMPERATURE_INTERRUPT();
+}
+
+#endif // TELEMETRY_RECORDER
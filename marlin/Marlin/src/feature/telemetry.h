@@ -0,0 +1,110 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Telemetry Recorder (TELEMETRY_RECORDER)
+ *
+ * The temperature ISR records a sample every TELEMETRY_INTERVAL ms into a
+ * ring of TELEMETRY_SAMPLES, overwriting the oldest sample when the ring is
+ * full. M582 sends the samples recorded since the last report as binary
+ * frames, now or every S seconds, so the host gets an even time series with
+ * no gaps between polls.
+ *
+ *   Frame   : SYNC LEN SEQ(uint16) SAMPLE... CRC16
+ *   SYNC    : 0xF6, which never starts an ASCII line
+ *   CRC16   : CRC-16/XMODEM of LEN, SEQ and the samples, little-endian
+ *   SEQ     : The number of the first sample. A jump means samples were lost.
+ *
+ *   SAMPLE  : ms(uint16)               Low 16 bits of millis()
+ *             temp(int16)[HEATERS]     Hotends then bed, in 0.1°C
+ *             power(uint8)[HEATERS]    Heater PWM, 0-127
+ *             planned(uint8)           Blocks in the planner
+ *             steps(int32)[AXES]       Stepper positions in steps, with E last
+ *             fan(uint8)[FANS]         Fan speeds, 0-255
+ *             rps(uint8)[TACHOS]       Fan tachometer revolutions per second
+ *
+ * All values are little-endian. 'M582 I' reports the counts for the layout.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/autoreport.h"
+
+#if HAS_FANCHECK
+  #include "fancheck.h"
+#endif
+
+#if HAS_HEATED_BED
+  #define TELEMETRY_HEATERS INCREMENT(HOTENDS)
+#else
+  #define TELEMETRY_HEATERS HOTENDS
+#endif
+#define TELEMETRY_TACHOS TERN0(HAS_FANCHECK, TACHO_COUNT)
+
+#define TELEMETRY_SYNC 0xF6
+
+typedef struct __attribute__((packed)) {
+  uint16_t ms;
+  #if TELEMETRY_HEATERS
+    int16_t temp[TELEMETRY_HEATERS];
+    uint8_t power[TELEMETRY_HEATERS];
+  #endif
+  uint8_t planned;
+  int32_t steps[LOGICAL_AXES];
+  #if HAS_FAN
+    uint8_t fan[FAN_COUNT];
+  #endif
+  #if TELEMETRY_TACHOS
+    uint8_t rps[TELEMETRY_TACHOS];
+  #endif
+} telemetry_sample_t;
+
+class Telemetry {
+public:
+  // Copy the latest temperatures for the ISR. Called when new readings are ready.
+  static void update_temps();
+
+  // Record a sample every TELEMETRY_INTERVAL. Called by the temperature ISR.
+  static void isr();
+
+  // Send the samples recorded so far
+  static void report();
+
+  // Report the sample layout
+  static void report_layout();
+
+  // Drop all the recorded samples
+  static void reset();
+
+  struct AutoReport { static void report() { Telemetry::report(); } };
+  static AutoReporter<AutoReport> auto_reporter;
+
+private:
+  static telemetry_sample_t samples[TELEMETRY_SAMPLES];
+  static volatile uint8_t head, count;  // Next sample to write, samples not yet sent
+  static volatile uint16_t seq;         // Number of the oldest sample not yet sent
+  #if TELEMETRY_HEATERS
+    static int16_t temps[TELEMETRY_HEATERS];
+  #endif
+};
+
+extern Telemetry telemetry;
@@ -87,7 +87,9 @@
       static uint32_t get_pwm_scale(TMC2130Stepper &st) { return st.PWM_SCALE(); }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2130Stepper &st) {
+    static uint32_t read_drv_status(TMC2130Stepper &st) { return st.DRV_STATUS(); }
+
+    static TMC_driver_data get_driver_data(TMC2130Stepper&, const uint32_t ds) {
       constexpr uint8_t OT_bp = 25, OTPW_bp = 26;
       constexpr uint32_t S2G_bm = 0x18000000;
       #if ENABLED(TMC_DEBUG)
@@ -98,7 +100,7 @@
         constexpr uint8_t STST_bp = 31;
       #endif
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       #ifdef __AVR__
 
         // 8-bit optimization saves up to 70 bytes of PROGMEM per axis
@@ -148,11 +150,13 @@
       static uint32_t get_pwm_scale(TMC2208Stepper &st) { return st.pwm_scale_sum(); }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2208Stepper &st) {
+    static uint32_t read_drv_status(TMC2208Stepper &st) { return st.DRV_STATUS(); }
+
+    static TMC_driver_data get_driver_data(TMC2208Stepper&, const uint32_t ds) {
       constexpr uint8_t OTPW_bp = 0, OT_bp = 1;
       constexpr uint8_t S2G_bm = 0b111100; // 2..5
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       data.is_otpw = TEST(ds, OTPW_bp);
       data.is_ot = TEST(ds, OT_bp);
       data.is_s2g = !!(ds & S2G_bm);
@@ -185,11 +189,13 @@
       static uint32_t get_pwm_scale(TMC2660Stepper) { return 0; }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2660Stepper &st) {
+    static uint32_t read_drv_status(TMC2660Stepper &st) { return st.DRVSTATUS(); }
+
+    static TMC_driver_data get_driver_data(TMC2660Stepper&, const uint32_t ds) {
       constexpr uint8_t OT_bp = 1, OTPW_bp = 2;
       constexpr uint8_t S2G_bm = 0b11000;
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRVSTATUS();
+      data.drv_status = ds;
       uint8_t spart = ds & 0xFF;
       data.is_otpw = TEST(spart, OTPW_bp);
       data.is_ot = TEST(spart, OT_bp);
@@ -231,11 +237,29 @@
     SString<50>(F(" driver overtemperature warning! ("), st.getMilliamps(), F("mA)")).echoln();
   }
 
+  // The TMC2209 has SG_RESULT in a register of its own. Only the debug report uses it.
+  template<typename TMC> static bool poll_sg_result(TMC&) { return false; }
+  template<typename TMC> static void get_sg_result(TMC&, TMC_driver_data&) {}
+  #if HAS_DRIVER(TMC2209) && ALL(TMC_DEBUG, HAS_STALLGUARD)
+    template<char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
+    static bool poll_sg_result(TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> &st) {
+      st.polled.sg_result = st.SG_RESULT();
+      return true;
+    }
+    template<char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
+    static void get_sg_result(TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> &st, TMC_driver_data &data) {
+      data.sg_result = st.polled.sg_result;
+      data.sg_result_reasonable = !data.is_standstill;
+    }
+  #endif
+
   template<typename TMC>
-  void report_polled_driver_data(TMC &st, const TMC_driver_data &data) {
-    const uint32_t pwm_scale = get_pwm_scale(st);
+  void report_polled_driver_data(TMC &st) {
+    TMC_driver_data data = get_driver_data(st, st.polled.drv_status);
+    if (data.drv_status == 0x0) return;
+    get_sg_result(st, data);
     st.printLabel();
-    SString<60> report(':', pwm_scale);
+    SString<60> report(':', st.polled.pwm_scale);
     #if ENABLED(TMC_DEBUG)
       #if HAS_TMCX1X0 || HAS_TMC220x
         report.append('/', data.cs_actual);
@@ -286,9 +310,22 @@
 
   #endif
 
+  /**
+   * Background driver poll
+   *
+   * Each call to monitor_tmc_drivers() reads at most one register, so a
+   * chain of UART drivers never stalls idle() for more than one transfer.
+   * Every MONITOR_DRIVER_STATUS_INTERVAL_MS a cycle visits each driver in
+   * turn, keeping the registers read in 'st.polled' for reports to use.
+   */
+  static bool need_update_error_counters, need_debug_reporting;
+  static uint8_t poll_driver, poll_register; // Driver and register to read next
+  static uint16_t step_down_axes;            // Axes with a driver that wants less current
+
+
   template<typename TMC>
-  bool monitor_tmc_driver(TMC &st, const bool need_update_error_counters, const bool need_debug_reporting) {
-    TMC_driver_data data = get_driver_data(st);
+  bool monitor_tmc_driver(TMC &st) {
+    TMC_driver_data data = get_driver_data(st, st.polled.drv_status);
     if (data.drv_status == 0xFFFFFFFF || data.drv_status == 0x0) return false;
 
     bool should_step_down = false;
@@ -322,99 +359,198 @@
       else if (st.otpw_count > 0) st.otpw_count = 0;
     }
 
-    #if ENABLED(TMC_DEBUG)
-      if (need_debug_reporting) report_polled_driver_data(st, data);
-    #endif
-
     return should_step_down;
   }
 
-  void monitor_tmc_drivers() {
-    const millis_t ms = millis();
-
-    // Poll TMC drivers at the configured interval
-    static millis_t next_poll = 0;
-    const bool need_update_error_counters = ELAPSED(ms, next_poll);
-    if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
-
-    // Also poll at intervals for debugging
-    #if ENABLED(TMC_DEBUG)
-      static millis_t next_debug_reporting = 0;
-      const bool need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
-      if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
-    #else
-      constexpr bool need_debug_reporting = false;
-    #endif
-
-    if (need_update_error_counters || need_debug_reporting) {
-
-      #if X_IS_TRINAMIC || X2_IS_TRINAMIC
-        if ( TERN0(X_IS_TRINAMIC, monitor_tmc_driver(stepperX, need_update_error_counters, need_debug_reporting))
-          || TERN0(X2_IS_TRINAMIC, monitor_tmc_driver(stepperX2, need_update_error_counters, need_debug_reporting))
-        ) {
-          TERN_(X_IS_TRINAMIC, step_current_down(stepperX));
-          TERN_(X2_IS_TRINAMIC, step_current_down(stepperX2));
-        }
+  // Read the next register of a driver, or check the driver once all are read.
+  // Return 'true' when the driver is done.
+  template<typename TMC>
+  static bool poll_tmc_driver(TMC &st, const AxisEnum axis) {
+    for (;;) switch (poll_register++) {
+      case 0: {
+        const uint32_t ds = read_drv_status(st);
+        st.polled.drv_status = (ds == 0xFFFFFFFF) ? 0 : ds;
+        return false;
+      }
+      #if ENABLED(TMC_DEBUG)
+        // Registers only needed for the debug report
+        case 1:
+          if (need_debug_reporting) { st.polled.pwm_scale = get_pwm_scale(st); return false; }
+          break;
+        case 2:
+          if (need_debug_reporting && poll_sg_result(st)) return false;
+          break;
       #endif
+      default:
+        poll_register = 0;
+        if (monitor_tmc_driver(st) && axis != NO_AXIS_ENUM) SBI(step_down_axes, axis);
+        return true;
+    }
+  }
 
-      #if Y_IS_TRINAMIC || Y2_IS_TRINAMIC
-        if ( TERN0(Y_IS_TRINAMIC, monitor_tmc_driver(stepperY, need_update_error_counters, need_debug_reporting))
-          || TERN0(Y2_IS_TRINAMIC, monitor_tmc_driver(stepperY2, need_update_error_counters, need_debug_reporting))
-        ) {
-          TERN_(Y_IS_TRINAMIC, step_current_down(stepperY));
-          TERN_(Y2_IS_TRINAMIC, step_current_down(stepperY2));
-        }
+  // Poll the next register in the cycle. Return 'true' at the end of the cycle.
+  static bool poll_next_register() {
+    #define _POLL(N, A, ST) case N: if (poll_tmc_driver(ST, A)) poll_driver++; return false
+    for (;; poll_driver++) switch (poll_driver) {
+      #if X_IS_TRINAMIC
+        _POLL( 0, X_AXIS, stepperX);
       #endif
-
-      #if ANY(Z_IS_TRINAMIC, Z2_IS_TRINAMIC, Z3_IS_TRINAMIC, Z4_IS_TRINAMIC)
-        if ( TERN0(Z_IS_TRINAMIC,  monitor_tmc_driver(stepperZ,  need_update_error_counters, need_debug_reporting))
-          || TERN0(Z2_IS_TRINAMIC, monitor_tmc_driver(stepperZ2, need_update_error_counters, need_debug_reporting))
-          || TERN0(Z3_IS_TRINAMIC, monitor_tmc_driver(stepperZ3, need_update_error_counters, need_debug_reporting))
-          || TERN0(Z4_IS_TRINAMIC, monitor_tmc_driver(stepperZ4, need_update_error_counters, need_debug_reporting))
-        ) {
-          TERN_(Z_IS_TRINAMIC,  step_current_down(stepperZ));
-          TERN_(Z2_IS_TRINAMIC, step_current_down(stepperZ2));
-          TERN_(Z3_IS_TRINAMIC, step_current_down(stepperZ3));
-          TERN_(Z4_IS_TRINAMIC, step_current_down(stepperZ4));
-        }
+      #if X2_IS_TRINAMIC
+        _POLL( 1, X_AXIS, stepperX2);
+      #endif
+      #if Y_IS_TRINAMIC
+        _POLL( 2, Y_AXIS, stepperY);
+      #endif
+      #if Y2_IS_TRINAMIC
+        _POLL( 3, Y_AXIS, stepperY2);
+      #endif
+      #if Z_IS_TRINAMIC
+        _POLL( 4, Z_AXIS, stepperZ);
+      #endif
+      #if Z2_IS_TRINAMIC
+        _POLL( 5, Z_AXIS, stepperZ2);
+      #endif
+      #if Z3_IS_TRINAMIC
+        _POLL( 6, Z_AXIS, stepperZ3);
+      #endif
+      #if Z4_IS_TRINAMIC
+        _POLL( 7, Z_AXIS, stepperZ4);
       #endif
-
       #if I_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperI, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperI);
+        _POLL( 8, I_AXIS, stepperI);
       #endif
       #if J_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperJ, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperJ);
+        _POLL( 9, J_AXIS, stepperJ);
       #endif
       #if K_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperK, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperK);
+        _POLL(10, K_AXIS, stepperK);
       #endif
       #if U_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperU, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperU);
+        _POLL(11, U_AXIS, stepperU);
       #endif
       #if V_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperV, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperV);
+        _POLL(12, V_AXIS, stepperV);
       #endif
       #if W_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperW, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperW);
+        _POLL(13, W_AXIS, stepperW);
+      #endif
+      #if E0_IS_TRINAMIC
+        _POLL(14, NO_AXIS_ENUM, stepperE0);
+      #endif
+      #if E1_IS_TRINAMIC
+        _POLL(15, NO_AXIS_ENUM, stepperE1);
+      #endif
+      #if E2_IS_TRINAMIC
+        _POLL(16, NO_AXIS_ENUM, stepperE2);
+      #endif
+      #if E3_IS_TRINAMIC
+        _POLL(17, NO_AXIS_ENUM, stepperE3);
+      #endif
+      #if E4_IS_TRINAMIC
+        _POLL(18, NO_AXIS_ENUM, stepperE4);
+      #endif
+      #if E5_IS_TRINAMIC
+        _POLL(19, NO_AXIS_ENUM, stepperE5);
+      #endif
+      #if E6_IS_TRINAMIC
+        _POLL(20, NO_AXIS_ENUM, stepperE6);
       #endif
+      #if E7_IS_TRINAMIC
+        _POLL(21, NO_AXIS_ENUM, stepperE7);
+      #endif
+      case 22: return true;
+      default: break; // Not a Trinamic driver
+    }
+    #undef _POLL
+  }
+
+  void monitor_tmc_drivers() {
+    static bool polling = false;
 
-      TERN_(E0_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE0, need_update_error_counters, need_debug_reporting));
-      TERN_(E1_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE1, need_update_error_counters, need_debug_reporting));
-      TERN_(E2_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE2, need_update_error_counters, need_debug_reporting));
-      TERN_(E3_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE3, need_update_error_counters, need_debug_reporting));
-      TERN_(E4_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE4, need_update_error_counters, need_debug_reporting));
-      TERN_(E5_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE5, need_update_error_counters, need_debug_reporting));
-      TERN_(E6_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE6, need_update_error_counters, need_debug_reporting));
-      TERN_(E7_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE7, need_update_error_counters, need_debug_reporting));
+    if (!polling) {
+      const millis_t ms = millis();
+
+      // Poll TMC drivers at the configured interval
+      static millis_t next_poll = 0;
+      need_update_error_counters = ELAPSED(ms, next_poll);
+      if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
+
+      // Also poll at intervals for debugging
+      #if ENABLED(TMC_DEBUG)
+        static millis_t next_debug_reporting = 0;
+        need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
+        if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
+      #endif
 
-      if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
+      if (!(need_update_error_counters || need_debug_reporting)) return;
+
+      polling = true;
+      poll_driver = poll_register = 0;
+      step_down_axes = 0;
     }
+
+    if (!poll_next_register()) return;
+
+    polling = false;
+
+    #if X_IS_TRINAMIC || X2_IS_TRINAMIC
+      if (TEST(step_down_axes, X_AXIS)) {
+        TERN_(X_IS_TRINAMIC, step_current_down(stepperX));
+        TERN_(X2_IS_TRINAMIC, step_current_down(stepperX2));
+      }
+    #endif
+
+    #if Y_IS_TRINAMIC || Y2_IS_TRINAMIC
+      if (TEST(step_down_axes, Y_AXIS)) {
+        TERN_(Y_IS_TRINAMIC, step_current_down(stepperY));
+        TERN_(Y2_IS_TRINAMIC, step_current_down(stepperY2));
+      }
+    #endif
+
+    #if ANY(Z_IS_TRINAMIC, Z2_IS_TRINAMIC, Z3_IS_TRINAMIC, Z4_IS_TRINAMIC)
+      if (TEST(step_down_axes, Z_AXIS)) {
+        TERN_(Z_IS_TRINAMIC,  step_current_down(stepperZ));
+        TERN_(Z2_IS_TRINAMIC, step_current_down(stepperZ2));
+        TERN_(Z3_IS_TRINAMIC, step_current_down(stepperZ3));
+        TERN_(Z4_IS_TRINAMIC, step_current_down(stepperZ4));
+      }
+    #endif
+
+    TERN_(I_IS_TRINAMIC, if (TEST(step_down_axes, I_AXIS)) step_current_down(stepperI));
+    TERN_(J_IS_TRINAMIC, if (TEST(step_down_axes, J_AXIS)) step_current_down(stepperJ));
+    TERN_(K_IS_TRINAMIC, if (TEST(step_down_axes, K_AXIS)) step_current_down(stepperK));
+    TERN_(U_IS_TRINAMIC, if (TEST(step_down_axes, U_AXIS)) step_current_down(stepperU));
+    TERN_(V_IS_TRINAMIC, if (TEST(step_down_axes, V_AXIS)) step_current_down(stepperV));
+    TERN_(W_IS_TRINAMIC, if (TEST(step_down_axes, W_AXIS)) step_current_down(stepperW));
+
+    #if ENABLED(TMC_DEBUG)
+      // Report the whole cycle at once so the line isn't broken up by other output
+      if (need_debug_reporting) {
+        TERN_(X_IS_TRINAMIC,  report_polled_driver_data(stepperX));
+        TERN_(X2_IS_TRINAMIC, report_polled_driver_data(stepperX2));
+        TERN_(Y_IS_TRINAMIC,  report_polled_driver_data(stepperY));
+        TERN_(Y2_IS_TRINAMIC, report_polled_driver_data(stepperY2));
+        TERN_(Z_IS_TRINAMIC,  report_polled_driver_data(stepperZ));
+        TERN_(Z2_IS_TRINAMIC, report_polled_driver_data(stepperZ2));
+        TERN_(Z3_IS_TRINAMIC, report_polled_driver_data(stepperZ3));
+        TERN_(Z4_IS_TRINAMIC, report_polled_driver_data(stepperZ4));
+        TERN_(I_IS_TRINAMIC,  report_polled_driver_data(stepperI));
+        TERN_(J_IS_TRINAMIC,  report_polled_driver_data(stepperJ));
+        TERN_(K_IS_TRINAMIC,  report_polled_driver_data(stepperK));
+        TERN_(U_IS_TRINAMIC,  report_polled_driver_data(stepperU));
+        TERN_(V_IS_TRINAMIC,  report_polled_driver_data(stepperV));
+        TERN_(W_IS_TRINAMIC,  report_polled_driver_data(stepperW));
+        TERN_(E0_IS_TRINAMIC, report_polled_driver_data(stepperE0));
+        TERN_(E1_IS_TRINAMIC, report_polled_driver_data(stepperE1));
+        TERN_(E2_IS_TRINAMIC, report_polled_driver_data(stepperE2));
+        TERN_(E3_IS_TRINAMIC, report_polled_driver_data(stepperE3));
+        TERN_(E4_IS_TRINAMIC, report_polled_driver_data(stepperE4));
+        TERN_(E5_IS_TRINAMIC, report_polled_driver_data(stepperE5));
+        TERN_(E6_IS_TRINAMIC, report_polled_driver_data(stepperE6));
+        TERN_(E7_IS_TRINAMIC, report_polled_driver_data(stepperE7));
+        SERIAL_EOL();
+      }
+    #endif
   }
 
 #endif // MONITOR_DRIVER_STATUS
@@ -713,7 +849,8 @@
       case TMC_DRV_OTPW:      if (st.otpw())    SERIAL_CHAR('*'); break;
       case TMC_OT:            if (st.ot())      SERIAL_CHAR('*'); break;
       case TMC_DRV_STATUS_HEX: {
-        const uint32_t drv_status = st.DRV_STATUS();
+        // Prefer the background poll's copy over waiting on the bus
+        const uint32_t drv_status = TERN0(MONITOR_DRIVER_STATUS, st.polled.drv_status) ?: st.DRV_STATUS();
         SERIAL_CHAR('\t');
         st.printLabel();
         SERIAL_CHAR('\t');
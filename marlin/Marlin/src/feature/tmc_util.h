@@ -66,6 +66,15 @@ class TMCStorage {
       bool flag_otpw = false;
       bool getOTPW() { return flag_otpw; }
       void clear_otpw() { flag_otpw = 0; }
+
+      // Registers read by the background poll, for reports that shouldn't wait on the bus
+      struct {
+        uint32_t drv_status = 0;    // 0 until the first good read
+        #if ENABLED(TMC_DEBUG)
+          uint32_t pwm_scale = 0;
+          uint16_t sg_result = 0;   // TMC2209 only. Other drivers have it in drv_status.
+        #endif
+      } polled;
     #endif
 
     uint16_t getMilliamps() { return val_mA; }
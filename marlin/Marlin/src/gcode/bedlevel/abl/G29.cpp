@@ -720,60 +720,31 @@ G29_TYPE GcodeSuite::G29() {
           TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT_F(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
 
           #if ENABLED(BD_SENSOR_PROBE_NO_STOP)
-            if (PR_INNER_VAR == inStart) {
-              char tmp_1[32];
-
-              // move to the start point of new line
-              abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
-              // Go to the end of the row/column ... and back up by one
-              // TODO: Why not just use... PR_INNER_VAR = inStop - inInc
-              for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; PR_INNER_VAR += inInc);
-              PR_INNER_VAR -= inInc;
-
-              // Get the coordinate of the resulting grid point
-              abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
-
-              // Coordinate that puts the probe at the grid point
-              abl.probePos -= probe.offset_xy;
-
-              // Put a G1 move into the buffer
-              // TODO: Instead of G1, we can just add the move directly to the planner...
-              //  {
-              //  destination = current_position; destination = abl.probePos;
-              //  REMEMBER(fr, feedrate_mm_s, XY_PROBE_FEEDRATE_MM_S);
-              //  prepare_line_to_destination();
-              //  }
-              sprintf_P(tmp_1, PSTR("G1X%d.%d Y%d.%d F%d"),
-                int(abl.probePos.x), int(abl.probePos.x * 10) % 10,
-                int(abl.probePos.y), int(abl.probePos.y * 10) % 10,
-                XY_PROBE_FEEDRATE
-              );
-              gcode.process_subcommands_now(tmp_1);
-
-              if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("destX: ", abl.probePos.x, " Y:", abl.probePos.y);
-
-              // Reset the inner counter back to the start
-              PR_INNER_VAR = inStart;
-
-              // Get the coordinate of the start of the row/column
-              abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
-            }
 
-            // Wait around until the real axis position reaches the comparison point
-            // TODO: Use NEAR() because float is imprecise
-            constexpr AxisEnum axis = TERN(PROBE_Y_FIRST, Y_AXIS, X_AXIS);
-            const float cmp = abl.probePos[axis] - probe.offset_xy[axis];
-            float pos;
-            for (;;) {
-              pos = planner.get_axis_position_mm(axis);
-              if (inInc > 0 ? (pos >= cmp) : (pos <= cmp)) break;
-              idle_no_sleep();
+            // Sweep the whole row/column at the first point, then use the samples for every point
+            if (faux)
+              abl.measured_z = 0.001f * random(-100, 101);
+            else {
+              constexpr AxisEnum axis = TERN(PROBE_Y_FIRST, Y_AXIS, X_AXIS);
+              if (PR_INNER_VAR == inStart) {
+                // Move to the start of the row/column
+                abl.measured_z = probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
+                if (!isnan(abl.measured_z)) {
+                  bdl.sweep_start(axis, abl.probe_position_lf[axis] - probe.offset_xy[axis], abl.gridSpacing[axis], PR_INNER_SIZE);
+
+                  // Move to the end of the row/column at constant speed, sampling all the way
+                  destination = current_position;
+                  destination[axis] = abl.probe_position_lf[axis] + abl.gridSpacing[axis] * (inStop - inInc) - probe.offset_xy[axis];
+                  prepare_internal_move_to_destination(XY_PROBE_FEEDRATE_MM_S);
+                  do { bdl.sweep_sample(); idle_no_sleep(); } while (planner.busy());
+                  bdl.sweep_sample();
+                }
+              }
+              if (!isnan(abl.measured_z)) {
+                abl.measured_z = current_position.z - bdl.sweep_result(PR_INNER_VAR);
+                if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("Swept ", PR_INNER_VAR, " z ", abl.measured_z);
+              }
             }
-            //if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM_P(axis == Y_AXIS ? PSTR("Y=") : PSTR("X=", pos);
-
-            safe_delay(4);
-            abl.measured_z = current_position.z - bdl.read();
-            if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("x_cur ", planner.get_axis_position_mm(X_AXIS), " z ", abl.measured_z);
 
           #else // !BD_SENSOR_PROBE_NO_STOP
 
@@ -239,7 +239,7 @@ void GcodeSuite::G29() {
         return echo_not_entered('J');
 
       if (parser.seenval('Z')) {
-        bedlevel.z_values[ix][iy] = parser.value_linear_units();
+        bedlevel.set_z(ix, iy, parser.value_linear_units());
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, bedlevel.z_values[ix][iy]));
       }
       else
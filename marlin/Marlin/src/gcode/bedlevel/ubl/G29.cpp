@@ -41,6 +41,8 @@ void GcodeSuite::G29() {
 
   bedlevel.G29();
 
+  TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh()); // Pick up any mesh changes
+
   TERN_(FULL_REPORT_TO_HOST_FEATURE, set_and_report_grblstate(M_IDLE));
 }
 
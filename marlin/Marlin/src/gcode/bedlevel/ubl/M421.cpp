@@ -66,6 +66,7 @@ void GcodeSuite::M421() {
   else {
     float &zval = bedlevel.z_values[ij.x][ij.y];                          // Altering this Mesh Point
     zval = hasN ? NAN : parser.value_linear_units() + (hasQ ? zval : 0);  // N=NAN, Z=NEWVAL, or Q=ADDVAL
+    TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh_point(ij.x, ij.y));  // Update the cells around it
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ij.x, ij.y, zval));          // Ping ExtUI in case it's showing the mesh
   }
 }
@@ -30,7 +30,7 @@
 /**
  * M486: A simple interface to cancel objects
  *
- *   T[count] : Reset objects and/or set the count
+ *   T[count] : Reset objects and/or set the count (up to CANCEL_OBJECTS_MAX)
  *   S<index> : Start an object with the given index
  *   P<index> : Cancel the object with the given index
  *   U<index> : Un-cancel object with the given index
@@ -39,10 +39,7 @@
  */
 void GcodeSuite::M486() {
 
-  if (parser.seen('T')) {
-    cancelable.reset();
-    cancelable.state.object_count = parser.intval('T', 1);
-  }
+  if (parser.seen('T')) cancelable.set_object_count(parser.intval('T', 1));
 
   if (parser.seenval('S'))
     cancelable.set_active_object(parser.value_int());
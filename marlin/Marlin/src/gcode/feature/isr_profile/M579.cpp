@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+
+#include "../../gcode.h"
+#include "../../../feature/isr_profile.h"
+
+/**
+ * M579: Report stepper ISR timing
+ *
+ * Prints the number of calls and min/avg/p99/max time in microseconds for
+ * the whole ISR and for each phase, plus the share of CPU time spent in the
+ * stepper ISR since the last reset.
+ *
+ *   R : Reset the statistics after reporting
+ */
+void GcodeSuite::M579() {
+  isr_profile.report();
+  if (parser.seen_test('R')) isr_profile.reset();
+}
+
+#endif // STEPPER_ISR_PROFILE
@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(TELEMETRY_RECORDER)
+
+#include "../../gcode.h"
+#include "../../../feature/telemetry.h"
+
+/**
+ * M582: Send recorded telemetry as binary frames. See feature/telemetry.h.
+ *
+ *   S<seconds> : Send new samples at this interval. S0 to stop.
+ *   I          : Report the sample layout instead
+ *   R          : Drop the recorded samples instead
+ *
+ * With no parameters send the samples recorded since the last report.
+ */
+void GcodeSuite::M582() {
+  if (parser.seen_test('I'))
+    telemetry.report_layout();
+  else if (parser.seen_test('R'))
+    telemetry.reset();
+  else if (parser.seenval('S'))
+    telemetry.auto_reporter.set_interval(parser.value_byte());
+  else
+    telemetry.report();
+}
+
+#endif // TELEMETRY_RECORDER
@@ -221,7 +221,7 @@ void GcodeSuite::get_destination_from_command() {
     if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS || cutter.cutter_mode == CUTTER_MODE_DYNAMIC) {
       // Set the cutter power in the planner to configure this move
       cutter.last_feedrate_mm_m = 0;
-      if (WITHIN(parser.codenum, 1, TERN(ARC_SUPPORT, 3, 1)) || TERN0(BEZIER_CURVE_SUPPORT, parser.codenum == 5)) {
+      if (WITHIN(parser.codenum, 1, TERN(ARC_SUPPORT, 3, 1)) || TERN0(BEZIER_CURVE_SUPPORT, parser.codenum == 5) || TERN0(LASER_RASTER, parser.codenum == 7)) {
         planner.laser_inline.status.isPowered = true;
         if (parser.seen('I')) cutter.set_enabled(true);       // This is set for backward LightBurn compatibility.
         if (parser.seenval('S')) {
@@ -343,6 +343,15 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
     }
   #endif
 
+  #if ENABLED(CANCEL_OBJECTS)
+    // Drop moves in a canceled object before they reach the planner
+    if (cancelable.state.skipping && cancelable.skip_move()) {
+      if (!no_ok) queue.ok_to_send();
+      return;
+    }
+    cancelable.sync_e();
+  #endif
+
   // Handle a known command or reply "unknown command"
 
   switch (parser.command_letter) {
@@ -366,6 +375,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 6: G6(); break;                                      // G6: Direct Stepper Move
       #endif
 
+      #if ENABLED(LASER_RASTER)
+        case 7: G7(); break;                                      // G7: Laser Raster Move
+      #endif
+
       #if ENABLED(FWRETRACT)
         case 10: G10(); break;                                    // G10: Retract / Swap Retract
         case 11: G11(); break;                                    // G11: Recover / Swap Recover
@@ -962,6 +975,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(STEPPER_ISR_PROFILE)
+        case 579: M579(); break;                                  // M579: Report stepper ISR timing
+      #endif
+
+      #if ENABLED(TELEMETRY_RECORDER)
+        case 582: M582(); break;                                  // M582: Send recorded telemetry
+      #endif
+
       #if ENABLED(NONLINEAR_EXTRUSION)
         case 592: M592(); break;                                  // M592: Nonlinear Extrusion control
       #endif
@@ -1188,13 +1209,17 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
  * This is called from the main loop()
  */
 void GcodeSuite::process_next_command() {
+  #ifdef LINUX_BENCHMARK
+    Benchmark::Probe command_probe(Benchmark::COMMAND);
+  #endif
+
   GCodeQueue::CommandLine &command = queue.ring_buffer.peek_next_command();
 
   PORT_REDIRECT(SERIAL_PORTMASK(command.port));
 
   TERN_(POWER_LOSS_RECOVERY, recovery.queue_index_r = queue.ring_buffer.index_r);
 
-  if (DEBUGGING(ECHO)) {
+  if (DEBUGGING(ECHO) && TERN1(BINARY_GCODE, uint8_t(command.buffer[0]) != BINARY_GCODE_SYNC)) {
     SERIAL_ECHO_START();
     SERIAL_ECHOLN(command.buffer);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
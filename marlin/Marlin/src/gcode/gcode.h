@@ -44,6 +44,7 @@
  * G3   - CCW ARC
  * G4   - Dwell S<seconds> or P<milliseconds>
  * G5   - Cubic B-spline with XYZE destination and IJPQ offsets
+ * G7   - Laser raster move X Y with D<base64 pixels>. (Requires LASER_RASTER)
  * G10  - Retract filament according to settings of M207 (Requires FWRETRACT)
  * G11  - Retract recover filament according to settings of M208 (Requires FWRETRACT)
  * G12  - Clean tool (Requires NOZZLE_CLEAN_FEATURE)
@@ -267,6 +268,8 @@
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires *_DRIVER_TYPE TMC(2130|2160|2208|2209|5130|5160))
  * M575 - Change the serial baud rate. (Requires BAUD_RATE_GCODE)
+ * M579 - Report stepper ISR timing and CPU load. (Requires STEPPER_ISR_PROFILE)
+ * M582 - Send recorded telemetry as binary frames, or every S<seconds>. (Requires TELEMETRY_RECORDER)
  * M592 - Get or set Nonlinear Extrusion parameters. (Requires NONLINEAR_EXTRUSION)
  * M593 - Get or set input shaping parameters. (Requires INPUT_SHAPING_[XY])
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
@@ -534,6 +537,10 @@ private:
     static void G6();
   #endif
 
+  #if ENABLED(LASER_RASTER)
+    static void G7();
+  #endif
+
   #if ENABLED(FWRETRACT)
     static void G10();
     static void G11();
@@ -1153,6 +1160,14 @@ private:
     static void M575();
   #endif
 
+  #if ENABLED(STEPPER_ISR_PROFILE)
+    static void M579();
+  #endif
+
+  #if ENABLED(TELEMETRY_RECORDER)
+    static void M582();
+  #endif
+
   #if ENABLED(NONLINEAR_EXTRUSION)
     static void M592();
     static void M592_report(const bool forReplay=true);
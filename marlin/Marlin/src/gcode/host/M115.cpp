@@ -133,6 +133,9 @@ void GcodeSuite::M115() {
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
+    // BINARY_GCODE (Framed binary G0-G3, G92, M204)
+    cap_line(F("BINARY_GCODE"), ENABLED(BINARY_GCODE));
+
     // EEPROM (M500, M501)
     cap_line(F("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
@@ -145,6 +148,9 @@ void GcodeSuite::M115() {
     // AUTOREPORT_TEMP (M155)
     cap_line(F("AUTOREPORT_TEMP"), ENABLED(AUTO_REPORT_TEMPERATURES));
 
+    // TELEMETRY (M582)
+    cap_line(F("TELEMETRY"), ENABLED(TELEMETRY_RECORDER));
+
     // PROGRESS (M530 S L, M531 <file>, M532 X L)
     cap_line(F("PROGRESS"), false);
 
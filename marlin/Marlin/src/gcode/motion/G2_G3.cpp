@@ -29,6 +29,14 @@
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
 
+#ifdef CURVE_MAX_DEVIATION
+  #include "../../libs/tessellate.h"
+#endif
+
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  #include "../../module/ft_motion.h"
+#endif
+
 #if N_ARC_CORRECTION < 1
   #undef N_ARC_CORRECTION
   #define N_ARC_CORRECTION 1
@@ -48,6 +56,7 @@
 /**
  * Plan an arc in 2 dimensions, with linear motion in the other axes.
  * The arc is traced with many small linear segments according to the configuration.
+ * With ARC_NATIVE_BLOCKS and FT Motion active the arc is queued as a single curved block.
  */
 void plan_arc(
   const xyze_pos_t &cart,   // Destination position
@@ -214,23 +223,76 @@ void plan_arc(
   // Feedrate for the move, scaled by the feedrate multiplier
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
-  // Get the ideal segment length for the move based on settings
-  const float ideal_segment_mm = (
-    #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
-      constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
-    #else
-      MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
-    #endif
-  );
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    // With FT Motion the arc can go to the planner as a single curved block,
+    // as long as the whole circle is within limits and no leveling is applied
+    float min_P, max_P, min_Q, max_Q;
+    soft_endstop.get_manual_axis_limits(axis_p, min_P, max_P);
+    soft_endstop.get_manual_axis_limits(axis_q, min_Q, max_Q);
+    if (ftMotion.cfg.active && !TERN0(HAS_LEVELING, planner.leveling_active)
+      && center_P - radius >= min_P && center_P + radius <= max_P
+      && center_Q - radius >= min_Q && center_Q + radius <= max_Q
+    ) {
+      PlannerHints hints(SQRT(sq(flat_mm)
+        GANG_N(SUB2(NUM_AXES),
+          + sq(travel_L), + sq(travel_I), + sq(travel_J), + sq(travel_K), + sq(travel_U), + sq(travel_V), + sq(travel_W)
+        )
+      ));
+      hints.arc.radius = radius;
+      hints.arc.start_angle = ATAN2(rvec.b, rvec.a);
+      hints.arc.angular_travel = angular_travel;
+      hints.arc.axis_p = axis_p;
+      hints.arc.axis_q = axis_q;
+
+      // A full circle has no chord to plan, so queue arcs over 180° as two halves
+      if (abs_angular_travel > RADIANS(180)) {
+        hints.millimeters *= 0.5f;
+        hints.arc.angular_travel *= 0.5f;
+        const float mid_angle = hints.arc.start_angle + hints.arc.angular_travel;
+        xyze_pos_t mid = (current_position + cart) * 0.5f;
+        mid[axis_p] = center_P + radius * cos(mid_angle);
+        mid[axis_q] = center_Q + radius * sin(mid_angle);
+        planner.buffer_line(mid, scaled_fr_mm_s, active_extruder, hints);
+        hints.arc.start_angle = mid_angle;
+      }
+
+      xyze_pos_t raw = cart;
+      apply_motion_limits(raw);
+      planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
 
-  // Number of whole segments based on the ideal segment length
-  const float nominal_segments = _MAX(FLOOR(flat_mm / ideal_segment_mm), min_segments),
-              nominal_segment_mm = flat_mm / nominal_segments;
+      current_position = cart;
+      return;
+    }
+  #endif
+
+  #ifdef CURVE_MAX_DEVIATION
+
+    // The fewest segments that keep every chord within CURVE_MAX_DEVIATION of the arc
+    const float nominal_segments = _MAX(arc_segments_for_deviation(radius, abs_angular_travel, CURVE_MAX_DEVIATION), min_segments);
+
+  #else
+
+    // Get the ideal segment length for the move based on settings
+    const float ideal_segment_mm = (
+      #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
+        constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
+      #else
+        MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
+      #endif
+    );
+
+    // Number of whole segments based on the ideal segment length
+    const float nominal_segments = _MAX(FLOOR(flat_mm / ideal_segment_mm), min_segments);
+
+  #endif
+
+  const float nominal_segment_mm = flat_mm / nominal_segments;
 
   // The number of whole segments in the arc, with best attempt to honor MIN_ARC_SEGMENT_MM and MAX_ARC_SEGMENT_MM
   const uint16_t segments = nominal_segment_mm > (MAX_ARC_SEGMENT_MM) ? CEIL(flat_mm / (MAX_ARC_SEGMENT_MM)) :
                             nominal_segment_mm < (MIN_ARC_SEGMENT_MM) ? _MAX(1, FLOOR(flat_mm / (MIN_ARC_SEGMENT_MM))) :
                             nominal_segments;
+
   const float segment_mm = flat_mm / segments;
 
   // Add hints to help optimize the move
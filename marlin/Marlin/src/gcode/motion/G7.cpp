@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include "../gcode.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../feature/spindle_laser.h"
+#include "../../feature/laser_raster.h"
+
+/**
+ * G7: Raster Engrave a straight line
+ *
+ *  X Y Z  The end of the line, as with G1
+ *  F      Feedrate
+ *  S      Laser power for a pixel value of 255, as with G1
+ *  D      Pixel values, 8 bits each, base64-encoded. Must be the last parameter.
+ *
+ * The pixels are spread evenly over the line. Requires inline mode (M3 I).
+ * Add some overscan at either end so all the pixels are burned at full speed.
+ *
+ * Example: G7 X10 F18000 S255 D/4CAf/8A
+ */
+void GcodeSuite::G7() {
+  if (!MOTION_CONDITIONS) return;
+
+  if (cutter.cutter_mode != CUTTER_MODE_CONTINUOUS) {
+    SERIAL_ERROR_MSG("G7 requires inline laser mode (M3 I).");
+    return;
+  }
+
+  uint8_t * const pixels = laser_raster.claim();
+  const int16_t count = parser.string_arg ? LaserRaster::decode(parser.string_arg, pixels, LASER_RASTER_PIXELS) : 0;
+  if (count < 0) {
+    SERIAL_ERROR_MSG("G7 D bad or too long (" STRINGIFY(LASER_RASTER_PIXELS) " pixels max).");
+    return;
+  }
+
+  get_destination_from_command();   // Get X Y Z F and set the laser power
+
+  // Keep the pixels together in a single block
+  apply_motion_limits(destination);
+  laser_raster.pending = count;
+  planner.buffer_line(destination, MMS_SCALED(feedrate_mm_s));
+  laser_raster.pending = 0;         // Dropped if the move was too short for a block
+  current_position = destination;
+}
+
+#endif // LASER_RASTER
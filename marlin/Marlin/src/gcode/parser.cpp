@@ -62,6 +62,9 @@ uint16_t GCodeParser::codenum;
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
   uint8_t GCodeParser::param[26];  // parameter offsets from command_ptr
+  #if ENABLED(BINARY_GCODE)
+    bool GCodeParser::binary_args;
+  #endif
 #else
   char *GCodeParser::command_args; // start of parameters
 #endif
@@ -82,6 +85,7 @@ void GCodeParser::reset() {
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
+    TERN_(BINARY_GCODE, binary_args = false); // Text values
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
 }
@@ -111,9 +115,16 @@ void GCodeParser::reset() {
  * by parsing a single line of G-Code. 58 bytes of SRAM are used to speed up seen/value.
  */
 void GCodeParser::parse(char *p) {
+  #ifdef LINUX_BENCHMARK
+    Benchmark::Probe parse_probe(Benchmark::PARSE);
+  #endif
 
   reset(); // No codes to report
 
+  #if ENABLED(BINARY_GCODE)
+    if (uint8_t(*p) == BINARY_GCODE_SYNC) return parse_binary(p);
+  #endif
+
   auto uppercase = [](char c) {
     return TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')) ? c + 'A' - 'a' : c;
   };
@@ -310,6 +321,16 @@ void GCodeParser::parse(char *p) {
       return;
     }
 
+    #if ENABLED(LASER_RASTER)
+      // Special handling for G7 ... D<base64 pixels>
+      // The pixel data must be the last parameter
+      if (param == 'D' && is_command('G', 7)) {
+        while (*p == ' ') p++;
+        string_arg = p;
+        return;
+      }
+    #endif
+
     #if ENABLED(GCODE_QUOTED_STRINGS)
       if (!quoted_string_arg && param == '"') {
         quoted_string_arg = true;
@@ -370,6 +391,41 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Set up the command and parameters from a queued binary command.
+   * Parameter offsets point at the stored floats, so nothing is parsed.
+   * A malformed command is left as '?' to be reported as unknown.
+   */
+  void GCodeParser::parse_binary(char * const p) {
+    static const uint8_t codenums[BGC_COUNT] PROGMEM = { 0, 1, 2, 3, 92, 204 };
+    static const char fields[] PROGMEM = BINARY_GCODE_FIELDS;
+
+    command_ptr = p;
+
+    const uint8_t cmd = p[BGQ_CMD];
+    const uint16_t mask = uint8_t(p[BGQ_MASK]) | (uint8_t(p[BGQ_MASK + 1]) << 8);
+    if (cmd >= BGC_COUNT || mask >= _BV(COUNT(fields) - 1)) return;
+
+    command_letter = cmd == BGC_M204 ? 'M' : 'G';
+    codenum = pgm_read_byte(&codenums[cmd]);
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (cmd <= TERN(ARC_SUPPORT, BGC_G3, BGC_G1)) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = 0);
+      }
+    #endif
+
+    binary_args = true;
+    char *v = p + BGQ_VALUES;
+    for (uint8_t i = 0; i < COUNT(fields) - 1; ++i)
+      if (TEST(mask, i)) { set(pgm_read_byte(&fields[i]), v); v += sizeof(float); }
+  }
+
+#endif // BINARY_GCODE
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
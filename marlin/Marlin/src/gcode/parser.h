@@ -34,6 +34,10 @@
   #include "../libs/hex_print.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "../feature/binary_gcode.h"
+#endif
+
 #if ENABLED(TEMPERATURE_UNITS_SUPPORT)
   typedef enum : uint8_t { TEMPUNIT_C, TEMPUNIT_K, TEMPUNIT_F } TempUnit;
 #endif
@@ -62,6 +66,9 @@ private:
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
+    #if ENABLED(BINARY_GCODE)
+      static bool binary_args;      // Values are binary floats, not text
+    #endif
   #else
     static char *command_args;      // Args start here, for slow scan
   #endif
@@ -148,7 +155,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = (valid_number(ptr) || TERN0(GCODE_QUOTED_STRINGS, *(ptr - 1) == '"')) ? ptr : nullptr;
+          value_ptr = (TERN0(BINARY_GCODE, binary_args) || valid_number(ptr) || TERN0(GCODE_QUOTED_STRINGS, *(ptr - 1) == '"')) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -236,6 +243,11 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if ENABLED(BINARY_GCODE)
+    // Populate all fields from a queued binary command
+    static void parse_binary(char * const p);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -256,6 +268,9 @@ public:
   // Float removes 'E' to prevent scientific notation interpretation
   static float value_float() {
     if (!value_ptr) return 0;
+    #if ENABLED(BINARY_GCODE)
+      if (binary_args) { float f; memcpy(&f, value_ptr, sizeof(f)); return f; }
+    #endif
     char *e = value_ptr;
     for (;;) {
       const char c = *e;
@@ -272,8 +287,14 @@ public:
   }
 
   // Code value as a long or ulong
-  static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static int32_t value_long() {
+    TERN_(BINARY_GCODE, if (binary_args && value_ptr) return LROUND(value_float()));
+    return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+  }
+  static uint32_t value_ulong() {
+    TERN_(BINARY_GCODE, if (binary_args && value_ptr) return LROUND(value_float()));
+    return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+  }
 
   // Code value for use as time
   static millis_t value_millis() { return value_ulong(); }
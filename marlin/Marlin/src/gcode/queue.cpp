@@ -41,6 +41,11 @@ GCodeQueue queue;
   #include "../feature/binary_stream.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "../feature/binary_gcode.h"
+  #include "../libs/crc16.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -54,6 +59,7 @@ PGMSTR(G28_STR, "G28");
 
 GCodeQueue::SerialState GCodeQueue::serial_state[NUM_SERIAL] = { 0 };
 GCodeQueue::RingBuffer GCodeQueue::ring_buffer = { 0 };
+int8_t GCodeQueue::serial_slot_port = -1;
 
 #if NO_TIMEOUTS > 0
   static millis_t last_command_time = 0;
@@ -91,6 +97,16 @@ PGM_P GCodeQueue::injected_commands_P; // = nullptr
  */
 char GCodeQueue::injected_commands[64]; // = { 0 }
 
+/**
+ * Move a partial serial line out of the write slot, so the slot
+ * can be filled by another source.
+ */
+void GCodeQueue::release_serial_slot() {
+  if (serial_slot_port < 0) return;
+  memcpy(serial_state[serial_slot_port].line_buffer, ring_buffer.commands[ring_buffer.index_w].buffer, MAX_CMD_SIZE);
+  serial_slot_port = -1;
+}
+
 /**
  * Commit the accumulated G-code command to the ring buffer,
  * also setting its origin info.
@@ -100,10 +116,30 @@ void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
 ) {
   commands[index_w].skip_ok = skip_ok;
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
+  #ifdef QUEUE_PORT_RESERVE
+    if (serial_ind.within(0, NUM_SERIAL - 1)) port_length[serial_ind.index]++;
+  #endif
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
+  TERN_(SD_MOVE_PREVIEW, sd_preview.commit(index_w));
   advance_w();
 }
 
+#ifdef QUEUE_PORT_RESERVE
+
+  /**
+   * Room in the queue for commands from a serial port, or from the SD card
+   * for no port. Each other port keeps room for QUEUE_PORT_RESERVE commands.
+   */
+  uint8_t GCodeQueue::RingBuffer::room(const serial_index_t p) const {
+    uint16_t held = length;
+    for (uint8_t q = 0; q < NUM_SERIAL; ++q)
+      if (q != p.index && port_length[q] < (QUEUE_PORT_RESERVE))
+        held += (QUEUE_PORT_RESERVE) - port_length[q];
+    return held < BUFSIZE ? BUFSIZE - held : 0;
+  }
+
+#endif
+
 /**
  * Copy a command from RAM into the main command buffer.
  * Return true if the command was successfully added.
@@ -113,6 +149,7 @@ bool GCodeQueue::RingBuffer::enqueue(const char *cmd, const bool skip_ok/*=true*
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
   if (*cmd == ';' || length >= BUFSIZE) return false;
+  release_serial_slot();
   strcpy(commands[index_w].buffer, cmd);
   commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
   return true;
@@ -257,7 +294,12 @@ void GCodeQueue::RingBuffer::ok_to_send() {
       while (NUMERIC_SIGNED(*p))
         SERIAL_CHAR(*p++);
     }
-    SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - length);
+    #ifdef QUEUE_PORT_RESERVE
+      const uint8_t free_slots = room(serial_ind);
+    #else
+      const uint8_t free_slots = BUFSIZE - length;
+    #endif
+    SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, free_slots);
   #endif
   SERIAL_EOL();
 }
@@ -276,7 +318,7 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
   SERIAL_ECHOLNPGM(STR_OK);
 }
 
-static bool serial_data_available(serial_index_t index) {
+static int serial_data_available(serial_index_t index) {
   const int a = SERIAL_IMPL.available(index);
   #if ENABLED(RX_BUFFER_MONITOR) && RX_BUFFER_SIZE
     if (a > RX_BUFFER_SIZE - 2) {
@@ -284,7 +326,7 @@ static bool serial_data_available(serial_index_t index) {
       SERIAL_ERROR_MSG("RX BUF overflow, increase RX_BUFFER_SIZE: ", a);
     }
   #endif
-  return a > 0;
+  return _MAX(a, 0);
 }
 
 #if NO_TIMEOUTS > 0
@@ -324,6 +366,7 @@ void GCodeQueue::gcode_line_error(FSTR_P const ferr, const serial_index_t serial
   while (read_serial(serial_ind) != -1) { /* nada */ } // Clear out the RX buffer. Why don't use flush here ?
   flush_and_request_resend(serial_ind);
   serial_state[serial_ind.index].count = 0;
+  if (serial_slot_port == serial_ind.index) serial_slot_port = -1;  // Drop the line
 }
 
 FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", but not "M290", etc
@@ -336,8 +379,9 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_QUOTED 2
 #define PS_PAREN  3
 #define PS_ESC    4
+#define PS_BINARY 8
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -393,7 +437,7 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;                    // "Normal" Serial Input State
   buff[ind] = '\0';                   // Of course, I'm a Terminator.
   const bool is_empty = (ind == 0);   // An empty line?
@@ -404,10 +448,81 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Add a character to the binary frame being received and queue the
+   * command once the frame is complete and valid.
+   * Return false if the frame was rejected and a resend was requested.
+   */
+  bool GCodeQueue::binary_frame_char(const serial_index_t p, const char c) {
+    SerialState &serial = serial_state[p.index];
+    uint8_t * const frame = (uint8_t*)serial.line_buffer;
+
+    frame[serial.count++] = c;
+    if (serial.count <= BGF_LEN) return true;
+
+    const uint8_t len = frame[BGF_LEN];
+    if (!WITHIN(len, BINARY_GCODE_MIN_PAYLOAD, MAX_CMD_SIZE - BINARY_GCODE_FRAME_SIZE(0))) {
+      serial.input_state = PS_NORMAL;
+      gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+      return false;
+    }
+    if (serial.count < BINARY_GCODE_FRAME_SIZE(len)) return true;
+
+    serial.input_state = PS_NORMAL;
+    serial.count = 0;
+
+    uint16_t crc = 0;
+    crc16(&crc, &frame[BGF_LEN], len + 1);
+    if (crc != (frame[BGF_N + len] | (frame[BGF_N + len + 1] << 8))) {
+      gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+      return false;
+    }
+
+    // The line number must be in the correct sequence
+    const uint16_t n = frame[BGF_N] | (frame[BGF_N + 1] << 8);
+    if (n != uint16_t(serial.last_N + 1)) {
+      if (uint16_t(serial.last_N - n) <= 1) return true; // A resend already in transit
+      gcode_line_error(F(STR_ERR_LINE_NO), p);
+      return false;
+    }
+    serial.last_N++;
+
+    // Queue as SYNC CMD MASK VALUE...
+    release_serial_slot();
+    char * const cmd = ring_buffer.commands[ring_buffer.index_w].buffer;
+    cmd[BGQ_SYNC] = BINARY_GCODE_SYNC;
+    memcpy(&cmd[BGQ_CMD], &frame[BGF_CMD], len - (BGF_CMD - BGF_N));
+
+    // A value count that disagrees with the mask makes an unknown command
+    uint8_t values = 0;
+    for (uint16_t mask = frame[BGF_MASK] | (frame[BGF_MASK + 1] << 8); mask; mask >>= 1) values += mask & 1;
+    if (len != BINARY_GCODE_MIN_PAYLOAD + values * sizeof(float)) cmd[BGQ_CMD] = BGC_COUNT;
+
+    if (IsStopped() && frame[BGF_CMD] <= BGC_G3) {
+      PORT_REDIRECT(SERIAL_PORTMASK(p));
+      SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+      LCD_MESSAGE(MSG_STOPPED);
+    }
+
+    #if NO_TIMEOUTS > 0
+      last_command_time = millis();
+    #endif
+
+    ring_buffer.commit_command(false OPTARG(HAS_MULTI_SERIAL, p));
+    return true;
+  }
+
+#endif // BINARY_GCODE
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
  * left on the serial port.
+ *
+ * Each port gives up to one line per pass, read straight into the
+ * queue's write slot unless another port has a line started there.
  */
 void GCodeQueue::get_serial_commands() {
   #if ENABLED(BINARY_FILE_TRANSFER)
@@ -441,33 +556,64 @@ void GCodeQueue::get_serial_commands() {
       // Check if the queue is full and exit if it is.
       if (ring_buffer.full()) return;
 
+      // Leave the data until this port has room in the queue
+      if (ring_buffer.full_for(p)) continue;
+
       // No data for this port ? Skip it
-      if (!serial_data_available(p)) continue;
+      int avail = serial_data_available(p);
+      if (!avail) continue;
 
       // Ok, we have some data to process, let's make progress here
       hadData = true;
 
-      const int c = read_serial(p);
-      if (c < 0) {
-        // This should never happen, let's log it
-        PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
-        // Crash here to get more information why it failed
-        BUG_ON("SP available but read -1");
-        SERIAL_ERROR_MSG(STR_ERR_SERIAL_MISMATCH);
-        SERIAL_FLUSH();
-        continue;
+      SerialState &serial = serial_state[p];
+
+      // Take all the received characters up to the end of a line
+      bool eol = false;
+      while (avail--) {
+        const int c = read_serial(p);
+        if (c < 0) {
+          // This should never happen, let's log it
+          PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
+          // Crash here to get more information why it failed
+          BUG_ON("SP available but read -1");
+          SERIAL_ERROR_MSG(STR_ERR_SERIAL_MISMATCH);
+          SERIAL_FLUSH();
+          break;
+        }
+
+        const char serial_char = (char)c;
+
+        #if ENABLED(BINARY_GCODE)
+          // A sync byte at the start of a line begins a binary frame
+          if (!serial.count && serial.input_state == PS_NORMAL && uint8_t(serial_char) == BINARY_GCODE_SYNC)
+            serial.input_state = PS_BINARY;
+
+          if (serial.input_state == PS_BINARY) {
+            if (!binary_frame_char(p, serial_char) || ring_buffer.full_for(p)) break;
+            continue;
+          }
+        #endif
+
+        if ((eol = ISEOL(serial_char))) break;
+
+        // Start a new line in the write slot, if no other port is using it
+        if (!serial.count && serial_slot_port < 0) serial_slot_port = p;
+
+        process_stream_char(serial_char, serial.input_state, serial_line(p), serial.count);
       }
 
-      const char serial_char = (char)c;
-      SerialState &serial = serial_state[p];
+      if (eol) {
 
-      if (ISEOL(serial_char)) {
+        char * const line = serial_line(p);
 
         // Reset our state, continue if the line was empty
-        if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
+        if (process_line_done(serial.input_state, line, serial.count)) {
+          if (serial_slot_port == p) serial_slot_port = -1;
           continue;
+        }
 
-        char* command = serial.line_buffer;
+        char* command = line;
 
         while (*command == ' ') command++;                   // Skip leading spaces
         char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
@@ -486,7 +632,10 @@ void GCodeQueue::get_serial_commands() {
           // The line number must be in the correct sequence.
           if (gcode_N != serial.last_N + 1 && !M110) {
             // A request-for-resend line was already in transit so we got two - oops!
-            if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) continue;
+            if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) {
+              if (serial_slot_port == p) serial_slot_port = -1;
+              continue;
+            }
             // A corrupted line or too high, indicating a lost line
             gcode_line_error(F(STR_ERR_LINE_NO), p);
             break;
@@ -548,11 +697,14 @@ void GCodeQueue::get_serial_commands() {
           last_command_time = ms;
         #endif
 
-        // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        // Add the command to the queue, where it may be already
+        if (serial_slot_port == p) {
+          serial_slot_port = -1;
+          ring_buffer.commit_command(false OPTARG(HAS_MULTI_SERIAL, p));
+        }
+        else
+          ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
       }
-      else
-        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
@@ -572,8 +724,11 @@ void GCodeQueue::get_serial_commands() {
     // Get commands if there are more in the file
     if (!card.isStillFetching()) return;
 
+    // SD lines are read straight into the write slot
+    release_serial_slot();
+
     int sd_count = 0;
-    while (!ring_buffer.full() && !card.eof()) {
+    while (!ring_buffer.full_for(serial_index_t()) && !card.eof()) {
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
@@ -598,6 +753,7 @@ void GCodeQueue::get_serial_commands() {
           #endif
 
           // Put the new command into the buffer (no "ok" sent)
+          TERN_(SD_MOVE_PREVIEW, sd_preview.cmd_end = card.getIndex());
           ring_buffer.commit_command(true);
 
           // Prime Power-Loss Recovery for the NEXT commit_command
@@ -622,6 +778,10 @@ void GCodeQueue::get_serial_commands() {
 void GCodeQueue::get_available_commands() {
   if (ring_buffer.full()) return;
 
+  #ifdef LINUX_BENCHMARK
+    Benchmark::Probe queue_probe(Benchmark::QUEUE);
+  #endif
+
   get_serial_commands();
 
   TERN_(HAS_MEDIA, get_sdcard_commands());
@@ -640,6 +800,9 @@ void GCodeQueue::exhaust() {
  */
 void GCodeQueue::advance() {
 
+  // The newest move may be planned to go on into queued SD moves, which now have to wait
+  TERN_(SD_MOVE_PREVIEW, if (injected_commands_P || injected_commands[0]) sd_preview.interrupt());
+
   // Process immediate commands
   if (process_injected_command_P() || process_injected_command()) return;
 
@@ -692,8 +855,11 @@ void GCodeQueue::advance() {
           ok_to_send();
       }
     }
-    else
+    else {
+      TERN_(SD_MOVE_PREVIEW, sd_preview.start_line(ring_buffer.index_r));
       gcode.process_next_command();
+      TERN_(SD_MOVE_PREVIEW, sd_preview.end_line());
+    }
 
   #else
 
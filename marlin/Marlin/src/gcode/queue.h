@@ -41,7 +41,7 @@ public:
      */
     long last_N;
     int count;                      //!< Number of characters read in the current line of serial input
-    char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
+    char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator, when not in the ring buffer's write slot
     uint8_t input_state;            //!< The input state
   };
 
@@ -72,14 +72,30 @@ public:
             index_r,                //!< Ring buffer's read position
             index_w;                //!< Ring buffer's write position
     CommandLine commands[BUFSIZE];  //!< The ring buffer of commands
+    #ifdef QUEUE_PORT_RESERVE
+      uint8_t port_length[NUM_SERIAL]; //!< Number of commands in the queue from each serial port
+    #endif
 
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
-    inline void clear() { length = index_r = index_w = 0; }
+    inline void clear() {
+      release_serial_slot();
+      length = index_r = index_w = 0;
+      #ifdef QUEUE_PORT_RESERVE
+        ZERO(port_length);
+      #endif
+    }
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
     inline void advance_w() { advance_pos(index_w, 1); }
-    inline void advance_r() { if (length) advance_pos(index_r, -1); }
+    inline void advance_r() {
+      if (!length) return;
+      #ifdef QUEUE_PORT_RESERVE
+        const serial_index_t p = commands[index_r].port;
+        if (p.within(0, NUM_SERIAL - 1)) port_length[p.index]--;
+      #endif
+      advance_pos(index_r, -1);
+    }
 
     void commit_command(const bool skip_ok
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind=serial_index_t())
@@ -93,6 +109,13 @@ public:
 
     inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
 
+    #ifdef QUEUE_PORT_RESERVE
+      uint8_t room(const serial_index_t p) const;
+      inline bool full_for(const serial_index_t p) const { return !room(p); }
+    #else
+      inline bool full_for(const serial_index_t) const { return full(); }
+    #endif
+
     inline bool occupied() const { return length != 0; }
 
     inline bool empty() const { return !occupied(); }
@@ -261,6 +284,18 @@ public:
 
 private:
 
+  /**
+   * A serial line is read straight into the ring buffer's write slot when
+   * it's free. Anything else that writes to the slot moves the line out.
+   */
+  static int8_t serial_slot_port;   //!< The port with a line in the write slot, or -1
+
+  static void release_serial_slot();
+
+  static char* serial_line(const uint8_t p) {
+    return p == serial_slot_port ? ring_buffer.commands[ring_buffer.index_w].buffer : serial_state[p].line_buffer;
+  }
+
   static void get_serial_commands();
 
   #if HAS_MEDIA
@@ -275,6 +310,10 @@ private:
 
   static void gcode_line_error(FSTR_P const ferr, const serial_index_t serial_ind);
 
+  #if ENABLED(BINARY_GCODE)
+    static bool binary_frame_char(const serial_index_t p, const char c);
+  #endif
+
   friend class GcodeSuite;
 };
 
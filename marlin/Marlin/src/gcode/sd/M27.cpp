@@ -31,6 +31,7 @@
  * M27: Get SD Card status
  *      OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
  *      OR, with 'C' get the current filename.
+ *      OR, with 'R' get the read-ahead statistics. (Requires SD_READ_AHEAD)
  */
 void GcodeSuite::M27() {
   if (parser.seen_test('C')) {
@@ -39,6 +40,13 @@ void GcodeSuite::M27() {
     return;
   }
 
+  #if ENABLED(SD_READ_AHEAD)
+    if (parser.seen_test('R')) {
+      card.readahead_report();
+      return;
+    }
+  #endif
+
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     if (parser.seenval('S')) {
       card.auto_reporter.set_interval(parser.value_byte());
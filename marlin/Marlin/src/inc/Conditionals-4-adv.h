@@ -1532,6 +1532,11 @@
   #define NUM_REDUNDANT_FANS 1
 #endif
 
+// Cancelable objects, as the original 32-bit mask
+#if ENABLED(CANCEL_OBJECTS) && !defined(CANCEL_OBJECTS_MAX)
+  #define CANCEL_OBJECTS_MAX 32
+#endif
+
 // Power-Loss Recovery
 #if ENABLED(POWER_LOSS_RECOVERY)
   #ifdef PLR_BED_THRESHOLD
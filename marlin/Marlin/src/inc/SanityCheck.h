@@ -140,6 +140,17 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+/**
+ * Uniform Thermistor Tables requirements
+ */
+#if ENABLED(UNIFORM_THERMISTOR_TABLES)
+  #if !defined(UNIFORM_THERMISTOR_SEGMENTS) || !WITHIN(UNIFORM_THERMISTOR_SEGMENTS, 16, 1024)
+    #error "UNIFORM_THERMISTOR_SEGMENTS must be between 16 and 1024."
+  #elif (UNIFORM_THERMISTOR_SEGMENTS) & ((UNIFORM_THERMISTOR_SEGMENTS) - 1)
+    #error "UNIFORM_THERMISTOR_SEGMENTS must be a power of 2."
+  #endif
+#endif
+
 /**
  * Hephestos 2 Heated Bed Kit requirements
  */
@@ -229,6 +240,18 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "SERIAL_PORT_3 cannot be the same as SERIAL_PORT_2."
   #endif
 #endif
+#if BUFSIZE > 255
+  #error "BUFSIZE must be 255 or less."
+#endif
+#ifdef QUEUE_PORT_RESERVE
+  #if !HAS_MULTI_SERIAL
+    #error "QUEUE_PORT_RESERVE requires SERIAL_PORT_2."
+  #elif QUEUE_PORT_RESERVE < 1
+    #error "QUEUE_PORT_RESERVE must be 1 or more."
+  #elif BUFSIZE <= (QUEUE_PORT_RESERVE) * NUM_SERIAL
+    #error "BUFSIZE must be larger than QUEUE_PORT_RESERVE times the number of serial ports."
+  #endif
+#endif
 #if !(defined(__AVR__) && defined(USBCON))
   #if ENABLED(SERIAL_XON_XOFF) && RX_BUFFER_SIZE < 1024
     #error "SERIAL_XON_XOFF requires RX_BUFFER_SIZE >= 1024 for reliable transfers without drops."
@@ -460,6 +483,45 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+/**
+ * SD Read-Ahead
+ */
+#if ENABLED(SD_READ_AHEAD)
+  #if !HAS_MEDIA
+    #error "SD_READ_AHEAD requires SDSUPPORT or USB_FLASH_DRIVE_SUPPORT."
+  #elif !defined(SD_READ_AHEAD_BLOCKS) || SD_READ_AHEAD_BLOCKS < 2
+    #error "SD_READ_AHEAD_BLOCKS must be 2 or greater."
+  #elif SD_READ_AHEAD_BLOCKS > 32
+    #error "SD_READ_AHEAD_BLOCKS must be 32 or smaller."
+  #endif
+#endif
+
+/**
+ * Compressed G-code Files
+ */
+#if ENABLED(SD_HEATSHRINK) && !HAS_MEDIA
+  #error "SD_HEATSHRINK requires SDSUPPORT or USB_FLASH_DRIVE_SUPPORT."
+#endif
+
+/**
+ * SD Move Preview
+ */
+#if ENABLED(SD_MOVE_PREVIEW)
+  #if DISABLED(SD_READ_AHEAD)
+    #error "SD_MOVE_PREVIEW requires SD_READ_AHEAD."
+  #elif IS_KINEMATIC
+    #error "SD_MOVE_PREVIEW is not compatible with DELTA, SCARA, or POLAR kinematics."
+  #elif !HAS_Z_AXIS
+    #error "SD_MOVE_PREVIEW requires a Z axis."
+  #elif defined(XY_FREQUENCY_LIMIT)
+    #error "SD_MOVE_PREVIEW is not compatible with XY_FREQUENCY_LIMIT."
+  #elif !defined(SD_PREVIEW_MOVES) || SD_PREVIEW_MOVES <= BUFSIZE
+    #error "SD_PREVIEW_MOVES must be greater than BUFSIZE."
+  #elif SD_PREVIEW_MOVES > 255
+    #error "SD_PREVIEW_MOVES must be 255 or smaller."
+  #endif
+#endif
+
 /**
  * Custom Event G-code
  */
@@ -1229,6 +1291,9 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
       #error "DELTA requires GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y to be 3 or higher."
     #endif
   #endif
+  #ifdef DELTA_SEGMENT_DEVIATION
+    static_assert(DELTA_SEGMENT_DEVIATION > 0, "DELTA_SEGMENT_DEVIATION must be greater than 0.");
+  #endif
 #endif
 
 /**
@@ -1699,6 +1764,14 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "DGUS_LCD_UI IA_CREALITY requires a mesh with no more than 25 points as defined by GRID_MAX_POINTS_X/Y."
 #endif
 
+#if ENABLED(MESH_CELL_COEFFICIENTS)
+  #if !HAS_MESH
+    #error "MESH_CELL_COEFFICIENTS requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR, or AUTO_BED_LEVELING_UBL."
+  #elif ENABLED(ABL_BILINEAR_SUBDIVISION)
+    #error "MESH_CELL_COEFFICIENTS is not compatible with ABL_BILINEAR_SUBDIVISION."
+  #endif
+#endif
+
 #if ENABLED(G26_MESH_VALIDATION)
   #if !HAS_EXTRUDERS
     #error "G26_MESH_VALIDATION requires at least one extruder."
@@ -2777,6 +2850,17 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+/**
+ * Log-structured flash EEPROM
+ */
+#if ENABLED(FLASH_EEPROM_LOG)
+  #if DISABLED(FLASH_EEPROM_EMULATION)
+    #error "FLASH_EEPROM_LOG requires FLASH_EEPROM_EMULATION."
+  #elif !defined(FLASH_LOG_BANK_SIZE)
+    #error "FLASH_EEPROM_LOG is not supported for this platform."
+  #endif
+#endif
+
 /**
  * Make sure features that need to write to the SD card can
  */
@@ -3870,8 +3954,10 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 
 #if !BLOCK_BUFFER_SIZE
   #error "BLOCK_BUFFER_SIZE must be non-zero."
-#elif BLOCK_BUFFER_SIZE > 64
+#elif BLOCK_BUFFER_SIZE > 256
   #error "A very large BLOCK_BUFFER_SIZE is not needed and takes longer to drain the buffer on pause / cancel."
+#elif defined(__AVR__) && BLOCK_BUFFER_SIZE > 64
+  #error "BLOCK_BUFFER_SIZE over 64 is only supported on 32-bit boards."
 #endif
 
 #if ENABLED(LED_CONTROL_MENU) && NONE(HAS_MARLINUI_MENU, DWIN_LCD_PROUI)
@@ -4076,6 +4162,21 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
         #error "LASER_POWER_TRAP requires SPINDLE_LASER_USE_PWM to function."
       #endif
     #endif
+    #if ENABLED(LASER_RASTER)
+      #if DISABLED(SPINDLE_LASER_USE_PWM)
+        #error "LASER_RASTER requires SPINDLE_LASER_USE_PWM to function."
+      #elif ENABLED(LASER_POWER_TRAP)
+        #error "LASER_RASTER is not compatible with LASER_POWER_TRAP."
+      #elif ENABLED(FT_MOTION)
+        #error "LASER_RASTER is not compatible with FT_MOTION."
+      #elif IS_KINEMATIC
+        #error "LASER_RASTER is not compatible with DELTA, SCARA, or POLAR kinematics."
+      #elif LASER_RASTER_BUFFERS < 2 || LASER_RASTER_BUFFERS > 255
+        #error "LASER_RASTER_BUFFERS must be from 2 to 255."
+      #elif MAX_CMD_SIZE < ((LASER_RASTER_PIXELS) + 2) / 3 * 4 + 48
+        #error "MAX_CMD_SIZE is too small for a G7 with LASER_RASTER_PIXELS."
+      #endif
+    #endif
   #else
     #if SPINDLE_LASER_POWERUP_DELAY < 1
       #error "SPINDLE_LASER_POWERUP_DELAY must be greater than 0."
@@ -4087,6 +4188,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #define _PIN_CONFLICT(P) (PIN_EXISTS(P) && P##_PIN == SPINDLE_LASER_PWM_PIN)
   #if ALL(SPINDLE_FEATURE, LASER_FEATURE)
     #error "Enable only one of SPINDLE_FEATURE or LASER_FEATURE."
+  #elif ENABLED(LASER_RASTER) && DISABLED(LASER_FEATURE)
+    #error "LASER_RASTER requires LASER_FEATURE."
   #elif NONE(SPINDLE_SERVO, SPINDLE_LASER_USE_PWM) && !PIN_EXISTS(SPINDLE_LASER_ENA)
     #error "(SPINDLE|LASER)_FEATURE requires SPINDLE_LASER_ENA_PIN, SPINDLE_LASER_USE_PWM, or SPINDLE_SERVO to control the power."
   #elif ENABLED(SPINDLE_CHANGE_DIR) && !PIN_EXISTS(SPINDLE_DIR)
@@ -4253,6 +4356,13 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "WIFI_SSID and WIFI_PWD only apply to ESP32 motherboard with WIFISUPPORT."
 #endif
 
+/**
+ * Sanity Check for Cancel Objects
+ */
+#if ENABLED(CANCEL_OBJECTS) && !WITHIN(CANCEL_OBJECTS_MAX, 1, 127)
+  #error "CANCEL_OBJECTS_MAX must be between 1 and 127."
+#endif
+
 /**
  * Sanity Check for Password Feature
  */
@@ -4270,6 +4380,37 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 #if ALL(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#if ENABLED(BINARY_FILE_TRANSFER) && defined(BINARY_STREAM_WRITE_BLOCKS)
+  #if !WITHIN(BINARY_STREAM_WRITE_BLOCKS, 1, 16)
+    #error "BINARY_STREAM_WRITE_BLOCKS must be between 1 and 16."
+  #elif defined(__AVR__) && BINARY_STREAM_WRITE_BLOCKS > 1
+    #error "BINARY_STREAM_WRITE_BLOCKS must be 1 on AVR to save RAM."
+  #endif
+#endif
+
+/**
+ * Sanity Check for BINARY_GCODE
+ */
+#if ENABLED(BINARY_GCODE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_GCODE requires FASTER_GCODE_PARSER."
+  #elif HAS_MEATPACK
+    #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_GCODE, not both."
+  #elif MAX_CMD_SIZE < 53
+    #error "BINARY_GCODE requires a MAX_CMD_SIZE of at least 53."
+  #endif
+#endif
+
+/**
+ * Sanity Check for TELEMETRY_RECORDER
+ */
+#if ENABLED(TELEMETRY_RECORDER)
+  #if !WITHIN(TELEMETRY_SAMPLES, 2, 255)
+    #error "TELEMETRY_SAMPLES must be from 2 to 255."
+  #elif TELEMETRY_INTERVAL < 1
+    #error "TELEMETRY_INTERVAL must be at least 1ms."
+  #endif
+#endif
 
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
@@ -4589,6 +4730,30 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #if HAS_DYNAMIC_FREQ_G
     static_assert(FTM_DEFAULT_DYNFREQ_MODE != dynFreqMode_MASS_BASED, "dynFreqMode_MASS_BASED requires an X axis and an extruder.");
   #endif
+  #if ENABLED(FTM_PACKED_COMMANDS)
+    static_assert(FTM_STEPS_PER_UNIT_TIME <= 127, "FTM_PACKED_COMMANDS requires FTM_STEPPER_FS / FTM_FS <= 127.");
+    static_assert((FTM_STEPPERCMD_BUFF_SIZE) / (FTM_STEPS_PER_UNIT_TIME) >= 2, "FTM_PACKED_COMMANDS requires FTM_STEPPERCMD_BUFF_SIZE of at least two FTM_TS intervals.");
+  #endif
+#endif
+
+// Curve tessellation
+#ifdef CURVE_MAX_DEVIATION
+  static_assert(CURVE_MAX_DEVIATION > 0, "CURVE_MAX_DEVIATION must be greater than 0.");
+#endif
+
+// Native arc blocks
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_NATIVE_BLOCKS requires ARC_SUPPORT."
+  #elif DISABLED(FT_MOTION)
+    #error "ARC_NATIVE_BLOCKS requires FT_MOTION."
+  #elif ENABLED(CLASSIC_JERK)
+    #error "ARC_NATIVE_BLOCKS requires Junction Deviation. Disable CLASSIC_JERK."
+  #elif ANY(IS_KINEMATIC, IS_CORE, MARKFORGED_XY, MARKFORGED_YX)
+    #error "ARC_NATIVE_BLOCKS is only supported on Cartesian machines."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "ARC_NATIVE_BLOCKS is not compatible with SKEW_CORRECTION."
+  #endif
 #endif
 
 // Multi-Stepping Limit
@@ -307,6 +307,7 @@ private:
 
           bedlevel.z_values[i][j] = mz - lsf_results.D;
         }
+        TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh());
         return false;
       }
 
@@ -321,6 +322,9 @@ private:
 
     #endif
 
+    // Rebuild the mesh cells around the selected point after it is edited
+    void refresh_point() { TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh_point(mesh_x, mesh_y)); }
+
     void manual_mesh_move(const bool zmove=false) {
       if (zmove) {
         planner.synchronize();
@@ -3471,8 +3475,10 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
             case LEVELING_SETTINGS_ZERO:
               if (draw)
                 drawMenuItem(row, ICON_Mesh, F("Mesh Zero"));
-              else
+              else {
                 ZERO(bedlevel.z_values);
+                TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh());
+              }
               break;
             case LEVELING_SETTINGS_UNDEF:
               if (draw)
@@ -3571,6 +3577,7 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
               drawMenuItem(row, ICON_Axis, F("+0.01mm Up"));
             else if (bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] < MAX_Z_OFFSET) {
               bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] += 0.01;
+              mesh_conf.refresh_point();
               gcode.process_subcommands_now(F("M290 Z0.01"));
               planner.synchronize();
               current_position.z += 0.01f;
@@ -3583,6 +3590,7 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
               drawMenuItem(row, ICON_AxisD, F("-0.01mm Down"));
             else if (bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] > MIN_Z_OFFSET) {
               bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] -= 0.01;
+              mesh_conf.refresh_point();
               gcode.process_subcommands_now(F("M290 Z-0.01"));
               planner.synchronize();
               current_position.z -= 0.01f;
@@ -3692,6 +3700,7 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
               drawMenuItem(row, ICON_Axis, F("+0.01mm Up"));
             else if (bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] < MAX_Z_OFFSET) {
               bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] += 0.01;
+              mesh_conf.refresh_point();
               gcode.process_subcommands_now(F("M290 Z0.01"));
               planner.synchronize();
               current_position.z += 0.01f;
@@ -3704,6 +3713,7 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
               drawMenuItem(row, ICON_Axis, F("-0.01mm Down"));
             else if (bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] > MIN_Z_OFFSET) {
               bedlevel.z_values[mesh_conf.mesh_x][mesh_conf.mesh_y] -= 0.01;
+              mesh_conf.refresh_point();
               gcode.process_subcommands_now(F("M290 Z-0.01"));
               planner.synchronize();
               current_position.z -= 0.01f;
@@ -4451,8 +4461,14 @@ void JyersDWIN::valueControl() {
           planner.buffer_line(current_position, homing_feedrate(Z_AXIS), active_extruder);
           planner.synchronize();
           break;
-        case ID_UBLMesh: mesh_conf.manual_mesh_move(true); break;
-        case ID_LevelManual: mesh_conf.manual_mesh_move(selection == LEVELING_M_OFFSET); break;
+        case ID_UBLMesh:
+          mesh_conf.refresh_point();
+          mesh_conf.manual_mesh_move(true);
+          break;
+        case ID_LevelManual:
+          mesh_conf.refresh_point();
+          mesh_conf.manual_mesh_move(selection == LEVELING_M_OFFSET);
+          break;
       #endif
     }
     if (funcpointer) funcpointer();
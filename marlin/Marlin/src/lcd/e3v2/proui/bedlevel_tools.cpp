@@ -119,6 +119,7 @@ bool drawing_mesh = false;
 
       bedlevel.z_values[i][j] = mz - lsf_results.D;
     }
+    TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh());
     return false;
   }
 
@@ -173,7 +174,11 @@ void BedLevelTools::probeXY() {
 
 void BedLevelTools::meshReset() {
   ZERO(bedlevel.z_values);
-  TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+  #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+    bedlevel.refresh_bed_level();
+  #elif ENABLED(MESH_CELL_COEFFICIENTS)
+    mesh_cells.refresh();
+  #endif
 }
 
 // Accessors
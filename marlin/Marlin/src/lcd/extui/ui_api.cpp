@@ -877,6 +877,7 @@ namespace ExtUI {
         if (WITHIN(pos.x, 0, (GRID_MAX_POINTS_X) - 1) && WITHIN(pos.y, 0, (GRID_MAX_POINTS_Y) - 1)) {
           bedlevel.z_values[pos.x][pos.y] = zoff;
           TERN_(ABL_BILINEAR_SUBDIVISION, bedlevel.refresh_bed_level());
+          TERN_(MESH_CELL_COEFFICIENTS, mesh_cells.refresh_point(pos.x, pos.y));
         }
       }
 
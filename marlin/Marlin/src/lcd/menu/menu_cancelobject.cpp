@@ -37,7 +37,10 @@ static void lcd_cancel_object_confirm() {
   const int8_t v = MenuItemBase::itemIndex;
   const char item_num[] = {
     ' ',
-    char((v > 9) ? '0' + (v / 10) : ' '),
+    #if CANCEL_OBJECTS_MAX > 100
+      char((v > 99) ? '0' + (v / 100) : ' '),
+    #endif
+    char((v > 9) ? '0' + (v / 10 % 10) : ' '),
     char('0' + (v % 10)),
     '\0'
   };
@@ -26,29 +26,44 @@
 
 #include "canvas.h"
 
+// Each half of the buffer holds one band, so the next band can be drawn
+// while DMA sends the other. Keep the halves 32-bit aligned for setBackground.
+#define CANVAS_BAND_WORDS (((TFT_BUFFER_WORDS) / 2) & ~1)
+
+uint16_t Canvas::left, Canvas::top;
 uint16_t Canvas::width, Canvas::height;
 uint16_t Canvas::startLine, Canvas::endLine;
 uint16_t Canvas::background_color;
 uint16_t *Canvas::buffer = TFT::buffer;
+bool Canvas::band_drawn;
 
 void Canvas::instantiate(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+  left = x;
+  top = y;
   Canvas::width = width;
   Canvas::height = height;
   startLine = 0;
   endLine = 0;
-
-  // The TFT handles DMA within the given canvas rectangle
-  // so whatever is drawn will be offset on the screen by x,y.
-  tft.set_window(x, y, x + width - 1, y + height - 1);
+  band_drawn = false;
 }
 
 void Canvas::next() {
   startLine = endLine;
-  endLine = (TFT_BUFFER_WORDS) < width * (height - startLine) ? startLine + (TFT_BUFFER_WORDS) / width : height;
+  endLine = (CANVAS_BAND_WORDS) < width * (height - startLine) ? startLine + (CANVAS_BAND_WORDS) / width : height;
+  band_drawn = true;
 }
 
 bool Canvas::toScreen() {
+  // The TFT handles DMA within the given canvas rectangle
+  // so whatever is drawn will be offset on the screen by x,y.
+  if (startLine == 0) tft.set_window(left, top, left + width - 1, top + height - 1);
+
   tft.write_sequence(buffer, width * (endLine - startLine));
+
+  // Draw the next band into the other half while this one is sent
+  buffer = buffer == TFT::buffer ? TFT::buffer + (CANVAS_BAND_WORDS) : TFT::buffer;
+  band_drawn = false;
+
   return endLine == height;
 }
 
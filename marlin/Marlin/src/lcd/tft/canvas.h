@@ -30,9 +30,11 @@
 class Canvas {
   private:
     static uint16_t background_color;
+    static uint16_t left, top;
     static uint16_t width, height;
     static uint16_t startLine, endLine;
     static uint16_t *buffer;
+    static bool band_drawn;
 
     inline static glyph_t *glyph(uint16_t *character) { return TFT_String::glyph(character); }
     inline static uint16_t getFontType() { return TFT_String::font_type(); }
@@ -46,6 +48,7 @@ class Canvas {
     static void instantiate(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
     static void next();
     static bool toScreen();
+    static bool isBandDrawn() { return band_drawn; }
 
     static void setBackground(uint16_t color);
     static void addText(uint16_t x, uint16_t y, uint16_t color, uint16_t *string, uint16_t maxWidth);
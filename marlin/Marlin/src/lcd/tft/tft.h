@@ -54,6 +54,11 @@
   #error "TFT_BUFFER_WORDS can not exceed DMA_MAX_WORDS"
 #endif
 
+#if TFT_BUFFER_WORDS < 2 * (TFT_WIDTH)
+  // The canvas draws into one half of the buffer while DMA sends the other
+  #error "TFT_BUFFER_WORDS must hold at least two lines of TFT_WIDTH pixels"
+#endif
+
 class TFT {
   private:
     static TFT_String string;
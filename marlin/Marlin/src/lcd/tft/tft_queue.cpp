@@ -34,22 +34,29 @@ uint8_t *TFT_Queue::current_task = nullptr;
 uint8_t *TFT_Queue::last_task = nullptr;
 uint8_t *TFT_Queue::last_parameter = nullptr;
 
-void TFT_Queue::reset() {
-  tft.abort();
+shownCanvas_t TFT_Queue::shown[];
+uint8_t TFT_Queue::next_shown = 0;
+uint32_t TFT_Queue::signature;
 
+void TFT_Queue::restart() {
   end_of_queue = queue;
   current_task = nullptr;
   last_task = nullptr;
   last_parameter = nullptr;
 }
 
+void TFT_Queue::reset() {
+  tft.abort();
+  restart();
+
+  // Aborted canvases may not have reached the screen
+  ZERO(shown);
+}
+
 void TFT_Queue::async() {
   if (!current_task) return;
   queueTask_t *task = (queueTask_t *)current_task;
 
-  // Check IO busy status
-  if (tft.is_busy()) return;
-
   if (task->state == TASK_STATE_COMPLETED) {
     task = (queueTask_t *)task->nextTask;
     current_task = (uint8_t *)task;
@@ -57,10 +64,11 @@ void TFT_Queue::async() {
 
   finish_sketch();
 
+  // A canvas may draw its next band while IO is busy. Everything else waits.
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
-    case TASK_FILL:         fill(task);   break;
-    case TASK_CANVAS:       canvas(task); break;
+    case TASK_END_OF_QUEUE: if (!tft.is_busy()) restart();    break;
+    case TASK_FILL:         if (!tft.is_busy()) fill(task);   break;
+    case TASK_CANVAS:                           canvas(task); break;
   }
 }
 
@@ -69,6 +77,15 @@ void TFT_Queue::finish_sketch() {
   queueTask_t *task = (queueTask_t *)last_task;
 
   if (task->state == TASK_STATE_SKETCH) {
+    if (is_shown((parametersCanvas_t *)(last_task + sizeof(queueTask_t)))) {
+      // The screen already shows this canvas, so the queue ends before it
+      end_of_queue = last_task;
+      task->type = TASK_END_OF_QUEUE;
+      task->state = TASK_STATE_READY;
+      last_task = nullptr;
+      return;
+    }
+
     *end_of_queue = TASK_END_OF_QUEUE;
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
@@ -102,13 +119,23 @@ void TFT_Queue::fill(queueTask_t *task) {
 void TFT_Queue::canvas(queueTask_t *task) {
   parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t));
 
-  uint16_t i;
-  uint8_t *item = ((uint8_t *)task_parameters) + sizeof(parametersCanvas_t);
-
   if (task->state == TASK_STATE_READY) {
     task->state = TASK_STATE_IN_PROGRESS;
     tftCanvas.instantiate(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
   }
+
+  // The band is drawn into the half of the buffer that DMA is not sending
+  if (!tftCanvas.isBandDrawn()) draw_band(task_parameters);
+
+  if (tft.is_busy()) return;
+
+  if (tftCanvas.toScreen()) task->state = TASK_STATE_COMPLETED;
+}
+
+void TFT_Queue::draw_band(parametersCanvas_t *task_parameters) {
+  uint16_t i;
+  uint8_t *item = ((uint8_t *)task_parameters) + sizeof(parametersCanvas_t);
+
   tftCanvas.next();
 
   for (i = 0; i < task_parameters->count; i++) {
@@ -138,12 +165,43 @@ void TFT_Queue::canvas(queueTask_t *task) {
     }
     item = ((parametersCanvasBackground_t *)item)->nextParameter;
   }
+}
 
-  if (tftCanvas.toScreen()) task->state = TASK_STATE_COMPLETED;
+// Fold a canvas parameter into the signature of its canvas. The link to the
+// next parameter is skipped, as it depends on the position in the queue.
+void TFT_Queue::sign(const uint8_t *parameter) {
+  const uint8_t *data = parameter + sizeof(CanvasSubtype) + sizeof(uint8_t *);
+  signature = (signature ^ *parameter) * 16777619UL;  // FNV-1a
+  while (data < end_of_queue) signature = (signature ^ *data++) * 16777619UL;
+}
+
+// Remember the signature of a finished canvas sketch.
+// Return true if the screen already shows the same canvas.
+bool TFT_Queue::is_shown(const parametersCanvas_t *canvas) {
+  for (uint8_t i = 0; i < TFT_SHOWN_CANVASES; i++) {
+    const shownCanvas_t &s = shown[i];
+    if (s.x == canvas->x && s.y == canvas->y && s.width == canvas->width && s.height == canvas->height && s.signature == signature)
+      return true;
+  }
+
+  forget_shown(canvas->x, canvas->y, canvas->width, canvas->height);
+  shown[next_shown] = { canvas->x, canvas->y, canvas->width, canvas->height, signature };
+  if (++next_shown == TFT_SHOWN_CANVASES) next_shown = 0;
+  return false;
+}
+
+// Forget canvases that will be drawn over
+void TFT_Queue::forget_shown(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height) {
+  for (uint8_t i = 0; i < TFT_SHOWN_CANVASES; i++) {
+    shownCanvas_t &s = shown[i];
+    if (s.x < x + width && x < s.x + s.width && s.y < y + height && y < s.y + s.height)
+      s.width = 0;
+  }
 }
 
 void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
   finish_sketch();
+  forget_shown(x, y, width, height);
 
   queueTask_t *task = (queueTask_t *)end_of_queue;
   last_task = (uint8_t *)task;
@@ -189,6 +247,8 @@ void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
   task_parameters->height = height;
   task_parameters->count = 0;
 
+  signature = 2166136261UL;
+
   if (!current_task) current_task = (uint8_t *)task;
 }
 
@@ -204,6 +264,7 @@ void TFT_Queue::set_background(uint16_t color) {
   end_of_queue += sizeof(parametersCanvasBackground_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  sign(last_parameter);
 }
 
 #define QUEUE_SAFETY_FREE_SPACE 100
@@ -227,6 +288,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint8_t *
   parameters->x = x;
   parameters->y = y;
   parameters->color = ENDIAN_COLOR(color);
+  parameters->count = 0;
   parameters->stringLength = 0;
   parameters->maxWidth = maxWidth;
 
@@ -245,6 +307,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint8_t *
 
   parameters->nextParameter = end_of_queue;
   task_parameters->count++;
+  sign(last_parameter);
 }
 
 void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint16_t *string, uint16_t maxWidth) {
@@ -259,6 +322,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint16_t
   parameters->x = x;
   parameters->y = y;
   parameters->color = ENDIAN_COLOR(color);
+  parameters->count = 0;
   parameters->stringLength = 0;
   parameters->maxWidth = maxWidth;
 
@@ -272,6 +336,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint16_t
   parameters->nextParameter = end_of_queue;
   parameters->stringLength = pointer - string;
   task_parameters->count++;
+  sign(last_parameter);
 }
 
 void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
@@ -291,7 +356,7 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   colorMode_t color_mode = images[image].colorMode;
 
-  if (color_mode == HIGHCOLOR) return;
+  if (color_mode == HIGHCOLOR) return sign(last_parameter);
 
   uint16_t *color = (uint16_t *)end_of_queue;
   uint8_t color_count = 0;
@@ -311,6 +376,7 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   end_of_queue = (uint8_t *)color;
   parameters->nextParameter = end_of_queue;
+  sign(last_parameter);
 }
 
 uint16_t gradient(uint16_t colorA, uint16_t colorB, uint16_t factor) {
@@ -365,6 +431,7 @@ void TFT_Queue::add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
   end_of_queue += sizeof(parametersCanvasBar_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  sign(last_parameter);
 }
 
 void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
@@ -383,6 +450,7 @@ void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t h
   end_of_queue += sizeof(parametersCanvasRectangle_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  sign(last_parameter);
 }
 
 #endif // HAS_GRAPHICAL_TFT
@@ -29,6 +29,10 @@
   #define TFT_QUEUE_SIZE              8192
 #endif
 
+#ifndef TFT_SHOWN_CANVASES
+  #define TFT_SHOWN_CANVASES            24  // Number of canvases remembered to skip redrawing unchanged ones
+#endif
+
 enum QueueTaskType : uint8_t {
   TASK_END_OF_QUEUE = 0x00,
   TASK_FILL,
@@ -118,6 +122,15 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+// A canvas rectangle and a signature of what was drawn into it
+typedef struct {
+  uint16_t x;
+  uint16_t y;
+  uint16_t width;
+  uint16_t height;
+  uint32_t signature;
+} shownCanvas_t;
+
 class TFT_Queue {
   private:
     static uint8_t queue[TFT_QUEUE_SIZE];
@@ -126,11 +139,21 @@ class TFT_Queue {
     static uint8_t *last_task;
     static uint8_t *last_parameter;
 
+    static shownCanvas_t shown[TFT_SHOWN_CANVASES];
+    static uint8_t next_shown;
+    static uint32_t signature;
+
+    static void restart();
     static void finish_sketch();
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
+    static void draw_band(parametersCanvas_t *task_parameters);
     static void handle_queue_overflow(uint16_t sizeNeeded);
 
+    static void sign(const uint8_t *parameter);
+    static bool is_shown(const parametersCanvas_t *canvas);
+    static void forget_shown(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height);
+
   public:
     static void reset();
     static void async();
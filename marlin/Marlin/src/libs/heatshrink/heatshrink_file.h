@@ -0,0 +1,180 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * libs/heatshrink/heatshrink_file.h
+ *
+ * Read a G-code file written by buildroot/share/scripts/gcode_heatshrink.py:
+ *
+ *   "HSGC" : Magic
+ *   uint8  : Window bits (HEATSHRINK_STATIC_WINDOW_BITS)
+ *   uint8  : Lookahead bits (HEATSHRINK_STATIC_LOOKAHEAD_BITS)
+ *   uint8  : Decompressed block size as a power of 2, 9 to 15
+ *   uint8  : Format version, 0
+ *   uint32 : Decompressed file size
+ *   uint32 : File position of the block index, one uint32 per block
+ *
+ * Each block is a uint16 compressed size followed by the compressed data.
+ * Blocks are compressed one at a time, so a seek only has to look up its
+ * block in the index and decompress the block up to the new position.
+ *
+ * The file type only needs read(buf, nbyte) and seekSet(pos). The position
+ * and size of the decompressed file are kept in the caller's variables.
+ */
+
+#include "../../core/serial.h"
+#include "heatshrink_decoder.h"
+
+template<typename T>
+class HeatshrinkFile {
+public:
+  HeatshrinkFile(T &file, uint32_t &pos, uint32_t &size) : file(file), pos(pos), size(size) {}
+
+  /**
+   * Check the newly-opened file for a compressed file header.
+   * Return 1 for a compressed file, now at position 0 with its decompressed size,
+   * 0 for a plain file, rewound to position 0,
+   * or -1 for a compressed file the decoder can't read.
+   */
+  int8_t open() {
+    struct [[gnu::packed]] {
+      char magic[4];
+      uint8_t window_bits, lookahead_bits, block_bits, version;
+      uint32_t size, index_pos;
+    } header;
+
+    if (file.read(&header, sizeof(header)) != sizeof(header) || memcmp(header.magic, "HSGC", 4)) {
+      file.seekSet(0);
+      return 0;
+    }
+
+    if (header.version
+      || header.window_bits != HEATSHRINK_STATIC_WINDOW_BITS
+      || header.lookahead_bits != HEATSHRINK_STATIC_LOOKAHEAD_BITS
+      || !WITHIN(header.block_bits, 9, 15)
+    ) return -1;
+
+    heatshrink_decoder_reset(&hsd);   // Drop anything left from the last file
+    size = header.size;
+    block_bits = header.block_bits;
+    index_pos = header.index_pos;
+    seek(0);
+    return 1;
+  }
+
+  /**
+   * Move to a decompressed file position. Look up its block in the index
+   * and decompress the block up to the position.
+   */
+  void seek(const uint32_t index) {
+    // The decoder may hold input or output from the block that was being read
+    heatshrink_decoder_reset(&hsd);
+    out_index = out_count = 0;
+    block_left = 0;
+    if (index >= size) { pos = size; return; }
+
+    const uint32_t block = index >> block_bits;
+    uint32_t block_pos;
+    file.seekSet(index_pos + block * sizeof(block_pos));
+    if (file.read(&block_pos, sizeof(block_pos)) != sizeof(block_pos)) {
+      SERIAL_ERROR_MSG(STR_SD_ERR_READ);
+      pos = size;
+      return;
+    }
+    file.seekSet(block_pos);
+
+    pos = block << block_bits;
+    while (pos < index && (out_index < out_count || fill())) {
+      const uint8_t n = _MIN(uint32_t(out_count - out_index), index - pos);
+      out_index += n;
+      pos += n;
+    }
+  }
+
+  // Get the next decompressed byte, or -1 at the end of the file
+  int16_t get() {
+    if (out_index >= out_count && !fill()) return -1;
+    pos++;
+    return out[out_index++];
+  }
+
+  // Decompress up to 'nbyte' bytes into 'buf'. Return the number of bytes.
+  int16_t read(void *buf, uint16_t nbyte) {
+    uint8_t *dst = (uint8_t*)buf;
+    uint16_t done = 0;
+    while (done < nbyte && (out_index < out_count || fill())) {
+      const uint8_t n = _MIN(uint16_t(out_count - out_index), uint16_t(nbyte - done));
+      memcpy(dst + done, &out[out_index], n);
+      out_index += n;
+      pos += n;
+      done += n;
+    }
+    return done;
+  }
+
+private:
+  T &file;
+  uint32_t &pos, &size;             // Decompressed file position and size
+
+  heatshrink_decoder hsd;
+  uint8_t out[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE]; // Decompressed bytes for get()
+  uint8_t out_index = 0, out_count = 0;
+  uint8_t block_bits = 0;           // Decompressed block size as a power of 2
+  uint16_t block_left = 0;          // Compressed bytes not yet given to the decoder
+  uint32_t index_pos = 0;           // File position of the block index
+
+  /**
+   * Decompress the next bytes of the file into the output buffer,
+   * starting the next block when the current one is used up.
+   * A read error ends the file, so the print stops instead of stalling.
+   * Return 'true' if there's new output.
+   */
+  bool fill() {
+    out_index = out_count = 0;
+    while (pos < size) {
+      size_t count;
+      heatshrink_decoder_poll(&hsd, out, sizeof(out), &count);
+      if (count) {
+        out_count = count;
+        return true;
+      }
+
+      // The decoder has used all its input. Give it more.
+      if (!block_left) {
+        if (file.read(&block_left, sizeof(block_left)) != sizeof(block_left) || !block_left) break;
+        heatshrink_decoder_reset(&hsd);
+      }
+      uint8_t in[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE];
+      const int16_t got = file.read(in, _MIN(block_left, sizeof(in)));
+      if (got <= 0) break;
+      block_left -= got;
+      heatshrink_decoder_sink(&hsd, in, got, &count);
+    }
+
+    if (pos < size) {
+      SERIAL_ERROR_MSG(STR_SD_ERR_READ);
+      pos = size;
+    }
+    return false;
+  }
+};
@@ -0,0 +1,93 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Curve tessellation with a chord-error bound
+ *
+ * Chooses the segments for arcs and cubic Bézier curves from a maximum
+ * chord deviation and the local curvature, so nearly straight stretches
+ * get long segments and tight bends get short ones.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+/**
+ * Return the number of equal chords needed to trace an arc of the given radius
+ * and angle so that no chord is more than max_dev from the arc.
+ *
+ * A chord with sagitta max_dev has half-length sqrt(max_dev * (2r - max_dev)),
+ * which spans an angle of 2 * asin(half / r) around the center.
+ */
+inline uint16_t arc_segments_for_deviation(const_float_t radius, const_float_t angle, const_float_t max_dev) {
+  if (max_dev >= radius) return 1 + (ABS(angle) > RADIANS(180)); // Any chord under 180° will do
+  const float half_chord = SQRT(max_dev * (2 * radius - max_dev)),
+              seg_angle = 2 * asinf(half_chord / radius);
+  return constrain(CEIL(ABS(angle) / seg_angle), 1, UINT16_MAX);
+}
+
+/**
+ * Cubic Bézier curve in a plane, split into chords within a deviation limit.
+ *
+ * Between t0 and t1 the chord of a curve B(t) is never more than
+ * (t1 - t0)^2 / 8 * max|B''(t)| away from the curve. The second derivative of
+ * a cubic is linear in t, so its largest magnitude over an interval is at one
+ * of the ends. This gives a step that is guaranteed to be within the limit.
+ */
+struct BezierTessellator {
+  xy_pos_t p0, p1, p2, p3,  // Control points
+           dd0, dd1;        // Second derivative at t = 0 and t = 1
+
+  BezierTessellator(const xy_pos_t &a, const xy_pos_t &b, const xy_pos_t &c, const xy_pos_t &d)
+    : p0(a), p1(b), p2(c), p3(d), dd0((a - b * 2 + c) * 6), dd1((b - c * 2 + d) * 6) {}
+
+  // Point on the curve at t
+  xy_pos_t eval(const_float_t t) const {
+    const float s = 1 - t;
+    return p0 * (s * s * s) + p1 * (3 * s * s * t) + p2 * (3 * s * t * t) + p3 * (t * t * t);
+  }
+
+  // Magnitude of the second derivative at t
+  float curvature(const_float_t t) const { return (dd0 * (1 - t) + dd1 * t).magnitude(); }
+
+  /**
+   * Return the end of the segment starting at t. This is the largest step that keeps
+   * the chord within max_dev, but at least min_step, and never beyond 1.
+   */
+  float next(const_float_t t, const_float_t max_dev, const_float_t min_step) const {
+    const float k = 8 * max_dev, a = curvature(t);
+    float step = a > k ? SQRT(k / a) : 1.0f;
+    NOMORE(step, 1 - t);
+    // The far end may bend harder. Shrinking the step can only lower the bound.
+    const float b = curvature(t + step);
+    if (b * sq(step) > k) step = SQRT(k / b);
+    NOLESS(step, min_step);
+    return _MIN(t + step, 1.0f);
+  }
+
+  // Number of segments needed for the whole curve
+  uint16_t segments(const_float_t max_dev, const_float_t min_step) const {
+    uint16_t n = 0;
+    for (float t = 0; t < 1; t = next(t, max_dev, min_step)) n++;
+    return n;
+  }
+};
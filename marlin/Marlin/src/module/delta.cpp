@@ -124,6 +124,68 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+#ifdef DELTA_SEGMENT_DEVIATION
+
+  // Delta hotend offsets shift the towers the other way
+  static xy_float_t tower_for_ik(const uint8_t t) {
+    #if HAS_HOTEND_OFFSET
+      return delta_tower[t] + xy_pos_t(hotend_offset[active_extruder]);
+    #else
+      return delta_tower[t];
+    #endif
+  }
+
+  /**
+   * Get the carriage heights above the effector at a position, and return the
+   * largest effector error on any axis per mm of carriage error.
+   *
+   * Each row of the Jacobian is (g.x, g.y, 1) with g = (tower - p) / h.
+   * The gain is the infinity norm of its inverse, taken from the adjugate.
+   */
+  static float delta_error_gain(const xy_pos_t &p, abc_float_t &h) {
+    xy_float_t g[ABC];
+    LOOP_ABC(t) {
+      const xy_float_t w = tower_for_ik(t) - p;
+      h[t] = SQRT(delta_diagonal_rod_2_tower[t] - HYPOT2(w.x, w.y));
+      g[t] = w / h[t];
+    }
+    const float c0 = g[1].x * g[2].y - g[2].x * g[1].y,
+                c1 = g[2].x * g[0].y - g[0].x * g[2].y,
+                c2 = g[0].x * g[1].y - g[1].x * g[0].y,
+                gx = ABS(g[1].y - g[2].y) + ABS(g[2].y - g[0].y) + ABS(g[0].y - g[1].y),
+                gy = ABS(g[2].x - g[1].x) + ABS(g[0].x - g[2].x) + ABS(g[1].x - g[0].x),
+                gz = ABS(c0) + ABS(c1) + ABS(c2);
+    return _MAX(gx, gy, gz) / ABS(c0 + c1 + c2);
+  }
+
+  uint16_t delta_segments_for_deviation(const xyz_pos_t &start, const xyz_pos_t &end, const_float_t max_dev) {
+    const xy_pos_t xy = end - start;
+    abc_float_t h0, h1, hm;
+    const float gain = _MAX(delta_error_gain(start, h0), delta_error_gain(end, h1), delta_error_gain(start + xy * 0.5f, hm));
+
+    // Sharpest bend of any carriage, where its rod is most level
+    float bend = 0;
+    LOOP_ABC(t) {
+      // An end out of reach of a rod leaves the segments to the time limit
+      if (!(h0[t] > 0 && h1[t] > 0)) return UINT16_MAX;
+      NOLESS(bend, delta_diagonal_rod_2_tower[t] / cu(_MIN(h0[t], h1[t])));
+    }
+
+    return constrain(CEIL(xy.magnitude() * SQRT(gain * bend / (8 * max_dev))), 1, UINT16_MAX);
+  }
+
+  void inverse_kinematics(delta_batch_t &batch, const uint8_t count) {
+    LOOP_ABC(t) {
+      const xy_float_t tower = tower_for_ik(t);
+      const float rod2 = delta_diagonal_rod_2_tower[t];
+      float * const out = batch.tower[t];
+      for (uint8_t i = 0; i < count; ++i)
+        out[i] = batch.z[i] + SQRT(rod2 - HYPOT2(tower.x - batch.x[i], tower.y - batch.y[i]));
+    }
+  }
+
+#endif // DELTA_SEGMENT_DEVIATION
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
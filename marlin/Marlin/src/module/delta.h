@@ -83,6 +83,34 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
+#ifdef DELTA_SEGMENT_DEVIATION
+
+  /**
+   * Return the number of equal segments that keep a straight move within
+   * max_dev of the line on every Cartesian axis.
+   *
+   * Along a straight line each carriage follows z + sqrt(L^2 - |p - tower|^2).
+   * Its second derivative never exceeds |xy|^2 * L^2 / h^3, where h is the
+   * height of the carriage above the effector. That height is lowest at one end
+   * of the move, so a carriage strays at most 1/n^2 / 8 of that bound from the
+   * straight joint move of a segment. The inverse Jacobian turns the carriage
+   * error into an effector error.
+   */
+  uint16_t delta_segments_for_deviation(const xyz_pos_t &start, const xyz_pos_t &end, const_float_t max_dev);
+
+  // Positions and tower heights for a batch of segments. With one array per
+  // coordinate the compiler can run each step over the whole batch in a row.
+  #define DELTA_IK_BATCH 8
+  struct delta_batch_t {
+    float x[DELTA_IK_BATCH], y[DELTA_IK_BATCH], z[DELTA_IK_BATCH],
+          tower[ABC][DELTA_IK_BATCH];
+  };
+
+  // Calculate the tower positions for the first 'count' positions of the batch
+  void inverse_kinematics(delta_batch_t &batch, const uint8_t count);
+
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -38,7 +38,11 @@ FTMotion ftMotion;
 
 ft_config_t FTMotion::cfg;
 bool FTMotion::busy; // = false
-ft_command_t FTMotion::stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE] = {0U}; // Stepper commands buffer.
+#if ENABLED(FTM_PACKED_COMMANDS)
+  ft_packed_t FTMotion::stepperCmdBuff[FTM_CMD_BUFF_SIZE];              // Step counts buffer.
+#else
+  ft_command_t FTMotion::stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE] = {0U}; // Stepper commands buffer.
+#endif
 int32_t FTMotion::stepperCmdBuff_produceIdx = 0, // Index of next stepper command write to the buffer.
         FTMotion::stepperCmdBuff_consumeIdx = 0; // Index of next stepper command read from the buffer.
 
@@ -74,6 +78,15 @@ float FTMotion::accel_P,                        // Acceleration prime of block.
       FTMotion::s_1e,                           // Position after acceleration phase of block.
       FTMotion::s_2e;                           // Position after acceleration and coasting phase of block.
 
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  // Arc data variables.
+  block_arc_t FTMotion::arc;                    // Arc of the current block. Radius 0 for a line.
+  float FTMotion::arcAnglePerMM;                // (rad/mm) Arc rotation per mm of travel
+  xy_float_t FTMotion::arcStartRad,             // (mm) Start point relative to the arc center
+             FTMotion::arcErrPerMM;             // (mm/mm) Difference from the stepped end point, spread over the arc
+  float *FTMotion::arcTrajP, *FTMotion::arcTrajQ; // Trajectories of the arc plane axes
+#endif
+
 uint32_t FTMotion::N1,                          // Number of data points in the acceleration phase.
          FTMotion::N2,                          // Number of data points in the coasting phase.
          FTMotion::N3;                          // Number of data points in the deceleration phase.
@@ -89,6 +102,12 @@ xyze_long_t FTMotion::steps = { 0 };            // Step count accumulator.
 
 uint32_t FTMotion::interpIdx = 0;               // Index of current data point being interpolated.
 
+#if ENABLED(FTM_PACKED_COMMANDS)
+  ft_packed_t FTMotion::unpack_cmd;             // Packed command being expanded by the Stepper ISR.
+  xyze_int_t FTMotion::unpack_err;              // Interpolation error accumulator for the packed command.
+  uint8_t FTMotion::unpack_ticks = 0;           // Stepper ticks left in the packed command.
+#endif
+
 // Shaping variables.
 #if HAS_FTM_SHAPING
   FTMotion::shaping_t FTMotion::shaping = {
@@ -199,7 +218,7 @@ void FTMotion::loop() {
 
   // Interpolation (generation of step commands from fixed time trajectory).
   while (batchRdyForInterp
-    && (stepperCmdBuffItems() < (FTM_STEPPERCMD_BUFF_SIZE) - (FTM_STEPS_PER_UNIT_TIME))) {
+    && (stepperCmdBuffItems() < (FTM_CMD_BUFF_SIZE) - TERN(FTM_PACKED_COMMANDS, 1, FTM_STEPS_PER_UNIT_TIME))) {
     convertToSteps(interpIdx);
     if (++interpIdx == FTM_BATCH_SIZE) {
       batchRdyForInterp = false;
@@ -369,6 +388,7 @@ void FTMotion::loop() {
 void FTMotion::reset() {
 
   stepperCmdBuff_produceIdx = stepperCmdBuff_consumeIdx = 0;
+  TERN_(FTM_PACKED_COMMANDS, unpack_ticks = 0);
 
   traj.reset();
 
@@ -419,6 +439,7 @@ void FTMotion::runoutBlock() {
 
   startPosn = endPosn_prevBlock;
   ratio.reset();
+  TERN_(ARC_NATIVE_BLOCKS, arc.radius = 0);
 
   const int32_t n_to_fill_batch = (FTM_WINDOW_SIZE) - makeVector_batchIdx;
 
@@ -442,7 +463,7 @@ void FTMotion::runoutBlock() {
 // Auxiliary function to get number of step commands in the buffer.
 int32_t FTMotion::stepperCmdBuffItems() {
   const int32_t udiff = stepperCmdBuff_produceIdx - stepperCmdBuff_consumeIdx;
-  return (udiff < 0) ? udiff + (FTM_STEPPERCMD_BUFF_SIZE) : udiff;
+  return (udiff < 0) ? udiff + (FTM_CMD_BUFF_SIZE) : udiff;
 }
 
 // Initializes storage variables before startup.
@@ -473,6 +494,24 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
   ratio = moveDist * oneOverLength;
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    // The arc plane axes follow the arc. All other axes move linearly by ratio.
+    arc = current_block->arc;
+    if (arc.radius) {
+      auto arc_traj = [](const AxisEnum axis) { return TERN_(HAS_Z_AXIS, axis == Z_AXIS ? traj.z :) axis == Y_AXIS ? traj.y : traj.x; };
+      arcTrajP = arc_traj(arc.axis_p);
+      arcTrajQ = arc_traj(arc.axis_q);
+      arcAnglePerMM = arc.angular_travel * oneOverLength;
+      arcStartRad.set(arc.radius * cos(arc.start_angle), arc.radius * sin(arc.start_angle));
+      // Rounding to whole steps moves the end point a little, so blend the difference in over the arc
+      const float end_angle = arc.start_angle + arc.angular_travel;
+      arcErrPerMM.set(
+        (moveDist[arc.axis_p] - (arc.radius * cos(end_angle) - arcStartRad.x)) * oneOverLength,
+        (moveDist[arc.axis_q] - (arc.radius * sin(end_angle) - arcStartRad.y)) * oneOverLength
+      );
+    }
+  #endif
+
   const float spm = totalLength / current_block->step_event_count;  // (steps/mm) Distance for each step
 
   f_s = spm * current_block->initial_rate;              // (steps/s) Start feedrate
@@ -603,6 +642,14 @@ void FTMotion::makeVector() {
     #define _SET_TRAJ(q) traj.q[makeVector_batchIdx] = startPosn.q + ratio.q * dist;
     LOGICAL_AXIS_MAP_LC(_SET_TRAJ);
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      if (arc.radius) {
+        const float angle = arc.start_angle + arcAnglePerMM * dist;
+        arcTrajP[makeVector_batchIdx] = startPosn[arc.axis_p] + arc.radius * cos(angle) - arcStartRad.x + arcErrPerMM.x * dist;
+        arcTrajQ[makeVector_batchIdx] = startPosn[arc.axis_q] + arc.radius * sin(angle) - arcStartRad.y + arcErrPerMM.y * dist;
+      }
+    #endif
+
     #if HAS_EXTRUDERS
       if (cfg.linearAdvEna) {
         float dedt_adj = (traj.e[makeVector_batchIdx] - e_raw_z1) * (FTM_FS);
@@ -691,6 +738,37 @@ void FTMotion::makeVector() {
   } while (blockProcRdy && !batchRdy);
 }
 
+#if ENABLED(FTM_PACKED_COMMANDS)
+
+/**
+ * Convert to steps
+ * - Store the whole steps to take on each axis over the FTM_TS interval.
+ * - The Stepper ISR can take one step per axis per tick, so anything beyond
+ *   FTM_STEPS_PER_UNIT_TIME is left for the next interval, as with unpacked commands.
+ */
+void FTMotion::convertToSteps(const uint32_t idx) {
+  ft_packed_t &cmd = stepperCmdBuff[stepperCmdBuff_produceIdx];
+
+  #define _PACK_STEPS(A,B) do{ \
+    const int32_t d = constrain(int32_t(trajMod.A[idx] * planner.settings.axis_steps_per_mm[B]) - steps.A, \
+                                -(FTM_STEPS_PER_UNIT_TIME), FTM_STEPS_PER_UNIT_TIME); \
+    cmd.A = d; steps.A += d; \
+  }while(0);
+
+  LOGICAL_AXIS_CODE(
+    _PACK_STEPS(e, E_AXIS_N(stepper.current_block->extruder)),
+    _PACK_STEPS(x, X_AXIS), _PACK_STEPS(y, Y_AXIS), _PACK_STEPS(z, Z_AXIS),
+    _PACK_STEPS(i, I_AXIS), _PACK_STEPS(j, J_AXIS), _PACK_STEPS(k, K_AXIS),
+    _PACK_STEPS(u, U_AXIS), _PACK_STEPS(v, V_AXIS), _PACK_STEPS(w, W_AXIS)
+  );
+
+  // Next circular buffer index
+  if (++stepperCmdBuff_produceIdx == (FTM_CMD_BUFF_SIZE))
+    stepperCmdBuff_produceIdx = 0;
+}
+
+#else // !FTM_PACKED_COMMANDS
+
 /**
  * Convert to steps
  * - Commands are written in a bitmask with step and dir as single bits.
@@ -761,4 +839,6 @@ void FTMotion::convertToSteps(const uint32_t idx) {
   } // FTM_STEPS_PER_UNIT_TIME loop
 }
 
+#endif // !FTM_PACKED_COMMANDS
+
 #endif // FT_MOTION
@@ -109,7 +109,11 @@ class FTMotion {
       reset();
     }
 
-    static ft_command_t stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE]; // Buffer of stepper commands.
+    #if ENABLED(FTM_PACKED_COMMANDS)
+      static ft_packed_t stepperCmdBuff[FTM_CMD_BUFF_SIZE];         // Buffer of step counts per FTM_TS.
+    #else
+      static ft_command_t stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE]; // Buffer of stepper commands.
+    #endif
     static int32_t stepperCmdBuff_produceIdx,             // Index of next stepper command write to the buffer.
                    stepperCmdBuff_consumeIdx;             // Index of next stepper command read from the buffer.
 
@@ -136,6 +140,38 @@ class FTMotion {
       return cfg.active ? axis_move_dir[axis] : stepper.last_direction_bits[axis];
     }
 
+    #if ENABLED(FTM_PACKED_COMMANDS)
+
+      /**
+       * Get the STEP/DIR bits for the next stepper tick, expanding the packed
+       * step counts with the same error accumulation as convertToSteps().
+       * Called from the Stepper ISR. Return false if there is nothing to do.
+       */
+      FORCE_INLINE static bool unpack_command(ft_command_t &command) {
+        if (!unpack_ticks) {
+          if (stepperCmdBuff_produceIdx == stepperCmdBuff_consumeIdx) return false;
+          unpack_cmd = stepperCmdBuff[stepperCmdBuff_consumeIdx];
+          if (++stepperCmdBuff_consumeIdx == (FTM_CMD_BUFF_SIZE)) stepperCmdBuff_consumeIdx = 0;
+          unpack_err.reset();
+          unpack_ticks = FTM_STEPS_PER_UNIT_TIME;
+        }
+        unpack_ticks--;
+
+        command = 0;
+        #define _FTM_UNPACK(A) do{ \
+          unpack_err.A += unpack_cmd.A; \
+          if (unpack_cmd.A >= 0) { \
+            if (unpack_err.A >= (FTM_CTS_COMPARE_VAL)) { command |= _BV(FT_BIT_DIR_##A) | _BV(FT_BIT_STEP_##A); unpack_err.A -= FTM_STEPS_PER_UNIT_TIME; } \
+          } \
+          else if (unpack_err.A <= -(FTM_CTS_COMPARE_VAL)) { command |= _BV(FT_BIT_STEP_##A); unpack_err.A += FTM_STEPS_PER_UNIT_TIME; } \
+        }while(0);
+        LOGICAL_AXIS_MAP(_FTM_UNPACK);
+        #undef _FTM_UNPACK
+        return true;
+      }
+
+    #endif
+
   private:
 
     static xyze_trajectory_t traj;
@@ -157,6 +193,15 @@ class FTMotion {
     static uint32_t N1, N2, N3;
     static uint32_t max_intervals;
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // Arc data variables.
+      static block_arc_t arc;               // Arc of the current block. Radius 0 for a line.
+      static float arcAnglePerMM;           // (rad/mm) Arc rotation per mm of travel
+      static xy_float_t arcStartRad,        // (mm) Start point relative to the arc center
+                        arcErrPerMM;        // (mm/mm) Difference from the stepped end point, spread over the arc
+      static float *arcTrajP, *arcTrajQ;    // Trajectories of the arc plane axes
+    #endif
+
     // Number of batches needed to propagate the current trajectory to the stepper.
     static constexpr uint32_t PROP_BATCHES = CEIL((FTM_WINDOW_SIZE) / (FTM_BATCH_SIZE)) - 1;
 
@@ -169,6 +214,13 @@ class FTMotion {
 
     static xyze_long_t steps;
 
+    #if ENABLED(FTM_PACKED_COMMANDS)
+      // Unpacking variables, used only by the Stepper ISR.
+      static ft_packed_t unpack_cmd;
+      static xyze_int_t unpack_err;
+      static uint8_t unpack_ticks;
+    #endif
+
     // Shaping variables.
     #if HAS_FTM_SHAPING
 
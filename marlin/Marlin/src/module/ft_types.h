@@ -81,3 +81,11 @@ typedef FTShapedAxes<ftMotionShaper_t> ft_shaped_shaper_t;
 typedef FTShapedAxes<dynFreqMode_t>    ft_shaped_dfm_t;
 
 typedef bits_t(FT_BIT_COUNT) ft_command_t;
+
+#if ENABLED(FTM_PACKED_COMMANDS)
+  // Steps to take on each axis over one FTM_TS interval (at most FTM_STEPS_PER_UNIT_TIME)
+  typedef xyze_int8_t ft_packed_t;
+  #define FTM_CMD_BUFF_SIZE ((FTM_STEPPERCMD_BUFF_SIZE) / (FTM_STEPS_PER_UNIT_TIME))
+#else
+  #define FTM_CMD_BUFF_SIZE (FTM_STEPPERCMD_BUFF_SIZE)
+#endif
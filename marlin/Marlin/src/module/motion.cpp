@@ -1602,6 +1602,9 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
       NOMORE(segments, cartesian_mm * RECIPROCAL(SCARA_MIN_SEGMENT_LENGTH));
     #elif ENABLED(POLAR)
       NOMORE(segments, cartesian_mm * RECIPROCAL(POLAR_MIN_SEGMENT_LENGTH));
+    #elif defined(DELTA_SEGMENT_DEVIATION)
+      // Use only as many segments as the path deviation requires
+      NOMORE(segments, delta_segments_for_deviation(current_position, destination, DELTA_SEGMENT_DEVIATION));
     #endif
 
     // At least one segment is required
@@ -1629,12 +1632,50 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
 
     // Calculate and execute the segments
     millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
-      segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
-        break;
-    }
+
+    #ifdef DELTA_SEGMENT_DEVIATION
+
+      // Run the kinematics for a batch of segments at a time
+      delta_batch_t batch;
+      xyze_pos_t cart[DELTA_IK_BATCH];
+      TERN_(HAS_EXTRUDERS, float batch_e[DELTA_IK_BATCH]);
+
+      while (segments > 1) {
+        const uint8_t count = _MIN(segments - 1, DELTA_IK_BATCH);
+        for (uint8_t i = 0; i < count; ++i) {
+          raw += segment_distance;
+          cart[i] = raw;
+          xyze_pos_t machine = raw;
+          TERN_(HAS_POSITION_MODIFIERS, planner.apply_modifiers(machine));
+          batch.x[i] = machine.x;
+          batch.y[i] = machine.y;
+          batch.z[i] = machine.z;
+          TERN_(HAS_EXTRUDERS, batch_e[i] = machine.e);
+        }
+
+        inverse_kinematics(batch, count);
+
+        bool queued = true;
+        for (uint8_t i = 0; queued && i < count; ++i) {
+          segment_idle(next_idle_ms);
+          delta.set(batch.tower[A_AXIS][i], batch.tower[B_AXIS][i], batch.tower[C_AXIS][i]);
+          TERN_(HAS_EXTRUDERS, delta.e = batch_e[i]);
+          queued = planner.buffer_kinematic_segment(cart[i], scaled_fr_mm_s, active_extruder, hints);
+        }
+        if (!queued) break;
+        segments -= count;
+      }
+
+    #else
+
+      while (--segments) {
+        segment_idle(next_idle_ms);
+        raw += segment_distance;
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
+          break;
+      }
+
+    #endif
 
     // Ensure last segment arrives at target location.
     planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
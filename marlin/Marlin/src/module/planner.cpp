@@ -113,6 +113,14 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(LASER_RASTER)
+  #include "../feature/laser_raster.h"
+#endif
+
+#if ENABLED(SD_MOVE_PREVIEW)
+  #include "../feature/sd_preview.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_NONE         0U
@@ -126,9 +134,10 @@ Planner planner;
  * A ring buffer of moves described in steps
  */
 block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
-volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be pushed
-                 Planner::block_buffer_nonbusy, // Index of the first non-busy block
-                 Planner::block_buffer_tail;    // Index of the busy block, if any
+volatile block_index_t Planner::block_buffer_head,    // Index of the next block to be pushed
+                       Planner::block_buffer_nonbusy, // Index of the first non-busy block
+                       Planner::block_buffer_tail;    // Index of the busy block, if any
+block_index_t Planner::block_buffer_planned;          // Index of the last block the forward pass doesn't need to revisit
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // Delay block delivery so initial blocks in an empty queue may merge
 
@@ -228,6 +237,10 @@ float Planner::previous_nominal_speed;
   last_move_t Planner::extruder_last_move[E_STEPPERS] = { 0 };
 #endif
 
+#if ENABLED(SD_MOVE_PREVIEW)
+  float Planner::preview_stop_speed_sqr; // = 0
+#endif
+
 #ifdef XY_FREQUENCY_LIMIT
   int8_t Planner::xy_freq_limit_hz = XY_FREQUENCY_LIMIT;
   float Planner::xy_freq_min_speed_factor = (XY_FREQUENCY_MIN_PERCENT) * 0.01f;
@@ -739,7 +752,7 @@ void Planner::init() {
  */
 block_t* Planner::get_current_block() {
   // Get the number of moves in the planner queue so far
-  const uint8_t nr_moves = movesplanned();
+  const block_index_t nr_moves = movesplanned();
 
   // If there are any moves queued ...
   if (nr_moves) {
@@ -775,8 +788,8 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
-block_t* Planner::get_future_block(const uint8_t offset) {
-  const uint8_t nr_moves = movesplanned();
+block_t* Planner::get_future_block(const block_index_t offset) {
+  const block_index_t nr_moves = movesplanned();
   if (nr_moves <= offset) return nullptr;
   block_t * const block = &block_buffer[block_inc_mod(block_buffer_tail, offset)];
   if (block->flag.recalculate) return nullptr;
@@ -1045,10 +1058,13 @@ bool Planner::reverse_pass_kernel(block_t * const current, const block_t * const
 void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
   // Initialize block index to the last block in the planner buffer.
   // This last block will have flag.recalculate set.
-  uint8_t block_index = prev_block_index(block_buffer_head);
+  block_index_t block_index = prev_block_index(block_buffer_head);
 
   // The ISR may change block_buffer_nonbusy so get a stable local copy.
-  uint8_t nonbusy_block_index = block_buffer_nonbusy;
+  block_index_t nonbusy_block_index = block_buffer_nonbusy;
+
+  // Unless the pass ends early the forward pass starts from the tail
+  block_buffer_planned = block_buffer_tail;
 
   const block_t *next = nullptr;
   // Don't try to change the entry speed of the first non-busy block.
@@ -1058,7 +1074,16 @@ void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
     // Only process movement blocks
     if (current->is_move()) {
       // If no entry speed increase was possible we end the reverse pass.
-      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr)) return;
+      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr)) {
+        // Nothing up to this block changed, so the forward pass can start from it. The newest block
+        // still needs its first trapezoid, so in that case start from the move before it instead.
+        if (!next) do {
+          if (block_index == nonbusy_block_index) return;
+          block_index = prev_block_index(block_index);
+        } while (!block_buffer[block_index].is_move());
+        block_buffer_planned = block_index;
+        return;
+      }
       next = current;
     }
 
@@ -1103,11 +1128,17 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
 /**
  * Do the forward pass and recalculate the trapezoid speed profiles for all blocks in the plan
  * according to entry/exit speeds.
+ * Blocks before block_buffer_planned are unchanged by the reverse pass, so they are skipped.
+ * With a long buffer this keeps the cost per new block down to the blocks that actually change.
  */
 void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
-  // Start with the block that's about to execute or is executing.
-  uint8_t block_index = block_buffer_tail,
-          head_block_index = block_buffer_head;
+  // Start with the block that's about to execute or is executing...
+  block_index_t block_index = block_buffer_tail;
+  const block_index_t head_block_index = block_buffer_head;
+
+  // ...or the last block left alone by the reverse pass, if the ISR hasn't consumed it yet.
+  if (block_dec_mod(block_buffer_planned, block_index) < block_dec_mod(head_block_index, block_index))
+    block_index = block_buffer_planned;
 
   block_t *block = nullptr, *next = nullptr;
   float next_entry_speed = 0.0f;
@@ -1185,6 +1216,82 @@ void Planner::recalculate(const_float_t safe_exit_speed_sqr) {
   recalculate_trapezoids(safe_exit_speed_sqr);
 }
 
+#if ENABLED(SD_MOVE_PREVIEW)
+
+  /**
+   * The newest block was planned to end at a speed the previewed SD moves could
+   * brake from. Those moves won't follow right away, so lower the entry speeds
+   * back from the newest block until they can all brake to a stop again.
+   *
+   * The reverse pass only ever raises entry speeds, so this does its own. Blocks
+   * that the Stepper ISR has already taken can't change, as with the reverse pass.
+   */
+  void Planner::plan_tail_stop() {
+    const float stop_speed_sqr = preview_stop_speed_sqr;
+    if (!stop_speed_sqr) return;
+    preview_stop_speed_sqr = 0;
+
+    // Find the newest move, unless the ISR has it already
+    block_index_t block_index = block_buffer_head;
+    block_t *current;
+    do {
+      if (block_index == block_buffer_nonbusy) return;
+      block_index = prev_block_index(block_index);
+      current = &block_buffer[block_index];
+    } while (!current->is_move());
+
+    // It needs a new trapezoid for its new exit speed
+    current->flag.recalculate = true;
+    if (stepper.is_block_busy(current)) {
+      current->flag.recalculate = false;
+      return;
+    }
+
+    // The ISR may change block_buffer_nonbusy so get a stable local copy.
+    block_index_t nonbusy_block_index = block_buffer_nonbusy;
+
+    // The forward pass starts from the first block with an unchanged entry speed
+    block_index_t planned = block_buffer_tail;
+
+    float exit_speed_sqr = stop_speed_sqr;
+    bool newest = true;
+    while (block_index != nonbusy_block_index) {
+      current = &block_buffer[block_index];
+
+      if (current->is_move()) {
+        const float entry_speed_sqr = max_allowable_speed_sqr(-current->acceleration, exit_speed_sqr, current->millimeters);
+        if (entry_speed_sqr >= current->entry_speed_sqr) {
+          // This block can already brake in time. Its trapezoid is redone if it's the newest.
+          if (!newest) { planned = block_index; break; }
+        }
+        else {
+          // Mark the block before changing it, so the ISR won't take it half done
+          current->flag.recalculate = true;
+          if (stepper.is_block_busy(current)) {
+            current->flag.recalculate = false;
+            break;
+          }
+          current->entry_speed_sqr = entry_speed_sqr;
+        }
+        exit_speed_sqr = current->entry_speed_sqr;
+        newest = false;
+      }
+
+      block_index = prev_block_index(block_index);
+
+      // Follow the ISR, as in reverse_pass()
+      while (nonbusy_block_index != block_buffer_nonbusy) {
+        if (block_index == nonbusy_block_index) break;
+        nonbusy_block_index = next_block_index(nonbusy_block_index);
+      }
+    }
+
+    block_buffer_planned = planned;
+    recalculate_trapezoids(stop_speed_sqr);
+  }
+
+#endif // SD_MOVE_PREVIEW
+
 /**
  * Apply fan speeds
  */
@@ -1276,7 +1383,7 @@ void Planner::check_axes_activity() {
     #endif
 
     #if HAS_DISABLE_AXES
-      for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+      for (block_index_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
         block_t * const bnext = &block_buffer[b];
         LOGICAL_AXIS_CODE(
           if (TERN0(DISABLE_E, bnext->steps.e)) axis_active.e = true,
@@ -1394,7 +1501,7 @@ void Planner::check_axes_activity() {
     if (thermalManager.degTargetHotend(active_extruder) < autotemp.min - 2) return; // Below the min?
 
     float high = 0.0f;
-    for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+    for (block_index_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
       const block_t * const block = &block_buffer[b];
       if (NUM_AXIS_GANG(block->steps.x, || block->steps.y, || block->steps.z, || block->steps.i, || block->steps.j, || block->steps.k, || block->steps.u, || block->steps.v, || block->steps.w)) {
         const float se = float(block->steps.e) / block->step_event_count * block->nominal_speed; // mm/sec
@@ -1597,9 +1704,13 @@ void Planner::quick_stop() {
   const bool was_enabled = stepper.suspend();
 
   // Drop all queue entries
-  const uint8_t tail_value = block_buffer_tail; // Read tail value once
+  const block_index_t tail_value = block_buffer_tail; // Read tail value once
   block_buffer_head = tail_value;
   block_buffer_nonbusy = tail_value;
+  block_buffer_planned = tail_value;
+
+  // Free the pixel buffers of the dropped raster moves
+  TERN_(LASER_RASTER, laser_raster.reset());
 
   // Restart the block delay for the first movement - As the queue was
   // forced to empty, there's no risk the ISR will touch this.
@@ -1736,7 +1847,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
 ) {
 
   // Wait for the next available block
-  uint8_t next_buffer_head;
+  block_index_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
   // If we are cleaning, do not accept queuing of movements
@@ -1772,11 +1883,23 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   block_buffer_head = next_buffer_head;
 
   // find a speed from which the new block can stop safely
-  const float safe_exit_speed_sqr = _MAX(
+  float safe_exit_speed_sqr = _MAX(
     TERN0(HINTS_SAFE_EXIT_SPEED, hints.safe_exit_speed_sqr),
     minimum_planner_speed_sqr
   );
 
+  #if ENABLED(SD_MOVE_PREVIEW)
+    // The SD moves queued after this one may be able to brake from a higher speed.
+    // Not if the Stepper ISR takes this block next, since the next move may not be planned in time.
+    const float preview_exit_speed_sqr = nonbusy_movesplanned() > 1 ? _MIN(sd_preview.exit_speed_sqr(), sq(block->nominal_speed)) : 0;
+    if (preview_exit_speed_sqr > safe_exit_speed_sqr) {
+      preview_stop_speed_sqr = safe_exit_speed_sqr;
+      safe_exit_speed_sqr = preview_exit_speed_sqr;
+    }
+    else
+      preview_stop_speed_sqr = 0;
+  #endif
+
   // Recalculate and optimize trapezoidal speed profiles
   recalculate(safe_exit_speed_sqr);
 
@@ -2109,6 +2232,9 @@ bool Planner::_populate_block(
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
+  // Attach the pixels of a G7 raster move, now that the block will be used
+  TERN_(LASER_RASTER, laser_raster.attach(block));
+
   TERN_(MIXING_EXTRUDER, mixer.populate_block(block->b_color));
 
   #if HAS_FAN
@@ -2233,7 +2359,7 @@ bool Planner::_populate_block(
   );
 
   // Get the number of non busy movements in queue (non busy means that they can be altered)
-  const uint8_t moves_queued = nonbusy_movesplanned();
+  const block_index_t moves_queued = nonbusy_movesplanned();
 
   // Slow down when the buffer starts to empty, rather than wait at the corner for a buffer refill
   #if ANY(SLOWDOWN, HAS_WIRED_LCD) || defined(XY_FREQUENCY_LIMIT)
@@ -2454,12 +2580,34 @@ bool Planner::_populate_block(
       );
     }
   }
+
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    block->arc = hints.arc;
+    if (block->arc.radius) {
+      // Both plane axes carry the full path acceleration somewhere along the arc
+      const uint32_t max_plane_accel = CEIL(_MIN(settings.max_acceleration_mm_per_s2[block->arc.axis_p], settings.max_acceleration_mm_per_s2[block->arc.axis_q]) * steps_per_mm);
+      NOMORE(accel, max_plane_accel);
+    }
+  #endif
+
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = uint32_t(accel * (float(1UL << 24) / (STEPPER_TIMER_RATE)));
   #endif
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    // Limit the arc speed so the centripetal acceleration (v^2 / r) stays within the acceleration
+    if (block->arc.radius) {
+      const float max_arc_speed_sqr = block->acceleration * block->arc.radius;
+      if (sq(block->nominal_speed) > max_arc_speed_sqr) {
+        const float arc_speed_factor = SQRT(max_arc_speed_sqr) / block->nominal_speed;
+        block->nominal_speed *= arc_speed_factor;
+        block->nominal_rate *= arc_speed_factor;
+      }
+    }
+  #endif
+
   #if HAS_ROUGH_LIN_ADVANCE
     block->la_advance_rate = 0;
     block->la_scaling = 0;
@@ -2546,6 +2694,18 @@ bool Planner::_populate_block(
      * => normalize the complete junction vector.
      * Elsewise, when needed JD will factor-in the E component
      */
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // An arc joins its neighbors along its end tangents, not along its chord
+      xyze_float_t arc_exit_vec;
+      if (block->arc.radius) {
+        arc_exit_vec = unit_vec;
+        set_arc_tangent(unit_vec, block->arc, block->arc.start_angle);
+        set_arc_tangent(arc_exit_vec, block->arc, block->arc.start_angle + block->arc.angular_travel);
+        normalize_junction_vector(unit_vec);
+        normalize_junction_vector(arc_exit_vec);
+      }
+      else
+    #endif
     if (ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX) || esteps > 0)
       normalize_junction_vector(unit_vec);  // Normalize with XYZE components
     else
@@ -2685,7 +2845,7 @@ bool Planner::_populate_block(
     }
     else vmax_junction_sqr = minimum_planner_speed_sqr;
 
-    prev_unit_vec = unit_vec;
+    prev_unit_vec = TERN(ARC_NATIVE_BLOCKS, block->arc.radius ? arc_exit_vec : unit_vec, unit_vec);
 
   #else // CLASSIC_JERK
 
@@ -2800,7 +2960,7 @@ bool Planner::_populate_block(
 void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_POSITION*/) {
 
   // Wait for the next available block
-  uint8_t next_buffer_head;
+  block_index_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
   // Clear block
@@ -2857,6 +3017,9 @@ bool Planner::buffer_segment(const abce_pos_t &abce
   , const uint8_t extruder/*=active_extruder*/
   , const PlannerHints &hints/*=PlannerHints()*/
 ) {
+  #ifdef LINUX_BENCHMARK
+    Benchmark::Probe plan_probe(Benchmark::PLAN);
+  #endif
 
   // If we are cleaning, do not accept queuing of movements
   if (cleaning_buffer_counter) return false;
@@ -2987,6 +3150,36 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
 
   #if IS_KINEMATIC
 
+    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
+    inverse_kinematics(machine);
+    TERN_(HAS_EXTRUDERS, delta.e = machine.e);
+
+    return buffer_kinematic_segment(cart, fr_mm_s, extruder, hints);
+
+  #else
+
+    return buffer_segment(machine, fr_mm_s, extruder, hints);
+
+  #endif
+
+} // buffer_line()
+
+#if IS_KINEMATIC
+
+  /**
+   * Add a new linear movement to the buffer, with the kinematic target
+   * already in 'delta'. Feedrate scaling is applied here.
+   *
+   * @param cart      Cartesian target of the move, used for the move distance
+   * @param fr_mm_s   (Target) speed of the move (mm/s)
+   * @param extruder  Target extruder
+   * @param hints     Parameters to aid planner calculations
+   */
+  bool Planner::buffer_kinematic_segment(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
+    , const uint8_t extruder/*=active_extruder*/
+    , const PlannerHints &hints/*=PlannerHints()*/
+  ) {
+
     #if HAS_JUNCTION_DEVIATION
       const xyze_pos_t cart_dist_mm = LOGICAL_AXIS_ARRAY(
         cart.e - position_cart.e,
@@ -3002,9 +3195,6 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       );
     #endif
 
-    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
-
     PlannerHints ph = hints;
     if (!hints.millimeters)
       ph.millimeters = get_move_distance(xyze_pos_t(cart_dist_mm) OPTARG(HAS_ROTATIONAL_AXES, ph.cartesian_move));
@@ -3065,20 +3255,15 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
 
     #endif // POLAR && FEEDRATE_SCALING
 
-    TERN_(HAS_EXTRUDERS, delta.e = machine.e);
     if (buffer_segment(delta OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), feedrate, extruder, ph)) {
       position_cart = cart;
       return true;
     }
     return false;
 
-  #else // !IS_KINEMATIC
+  } // buffer_kinematic_segment()
 
-    return buffer_segment(machine, fr_mm_s, extruder, hints);
-
-  #endif
-
-} // buffer_line()
+#endif // IS_KINEMATIC
 
 #if ENABLED(DIRECT_STEPPING)
 
@@ -3088,7 +3273,7 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       return;
     }
 
-    uint8_t next_buffer_head;
+    block_index_t next_buffer_head;
     block_t * const block = get_next_free_block(next_buffer_head);
 
     block->flag.reset(BLOCK_BIT_PAGE);
@@ -192,10 +192,26 @@ typedef struct {
       float trap_ramp_entry_incr;                     // Acceleration per step laser power increment (trap entry)
       float trap_ramp_exit_decr;                      // Deceleration per step laser power decrement (trap exit)
     #endif
+
+    #if ENABLED(LASER_RASTER)
+      uint16_t raster_count;                          // G7 pixels spread over this block. 0 for other moves.
+      uint8_t raster_buffer;                          // Index of the pixel buffer in laser_raster
+    #endif
   } block_laser_t;
 
 #endif
 
+#if ENABLED(ARC_NATIVE_BLOCKS)
+
+  typedef struct {
+    float radius,                                     // Arc radius in mm. Zero for a linear block.
+          start_angle,                                // Angle of the start point around the arc center
+          angular_travel;                             // Signed angle swept by the arc. Positive is CCW.
+    AxisEnum axis_p, axis_q;                          // The axes of the arc plane
+  } block_arc_t;
+
+#endif
+
 /**
  * struct block_t
  *
@@ -216,15 +232,6 @@ typedef struct PlannerBlock {
   bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
   bool is_move() { return !(is_sync() || is_page()); }
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed,                      // The nominal speed for this block in (mm/sec)
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        min_entry_speed_sqr,                // Minimum allowable junction entry speed in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        steps_per_mm,                       // steps/mm
-        acceleration;                       // acceleration mm/sec^2
-
   union {
     abce_ulong_t steps;                     // Step count along each axis
     abce_long_t position;                   // New position to force when this sync block is executed
@@ -309,6 +316,20 @@ typedef struct PlannerBlock {
     block_laser_t laser;
   #endif
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    block_arc_t arc;                        // Arc geometry, interpolated by FT Motion
+  #endif
+
+  // Fields used by the motion planner to manage acceleration.
+  // Kept after everything the Stepper ISR reads, so the ISR's fields share fewer cache lines.
+  float nominal_speed,                      // The nominal speed for this block in (mm/sec)
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        min_entry_speed_sqr,                // Minimum allowable junction entry speed in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        steps_per_mm,                       // steps/mm
+        acceleration;                       // acceleration mm/sec^2
+
   void reset() { memset((char*)this, 0, sizeof(*this)); }
 
 } block_t;
@@ -317,11 +338,18 @@ typedef struct PlannerBlock {
   #define HAS_POSITION_FLOAT 1
 #endif
 
-constexpr uint8_t block_dec_mod(const uint8_t v1, const uint8_t v2) {
+// Index into the block buffer, wide enough for any BLOCK_BUFFER_SIZE
+typedef uvalue_t(BLOCK_BUFFER_SIZE) block_index_t;
+
+// Indexes wrap with block_inc_mod / block_dec_mod, not by overflow, but
+// counts such as movesplanned() must be able to reach BLOCK_BUFFER_SIZE.
+static_assert(block_index_t(BLOCK_BUFFER_SIZE) == (BLOCK_BUFFER_SIZE), "block_index_t is too small for BLOCK_BUFFER_SIZE.");
+
+constexpr block_index_t block_dec_mod(const block_index_t v1, const block_index_t v2) {
   return v1 >= v2 ? v1 - v2 : v1 - v2 + BLOCK_BUFFER_SIZE;
 }
 
-constexpr uint8_t block_inc_mod(const uint8_t v1, const uint8_t v2) {
+constexpr block_index_t block_inc_mod(const block_index_t v1, const block_index_t v2) {
   return v1 + v2 < BLOCK_BUFFER_SIZE ? v1 + v2 : v1 + v2 - BLOCK_BUFFER_SIZE;
 }
 
@@ -429,6 +457,10 @@ struct PlannerHints {
                                       // would calculate if it knew the as-yet-unbuffered path
   #endif
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    block_arc_t arc = { 0.0f };       // Arc geometry for a single-block arc. Radius 0 for a line.
+  #endif
+
   #if HAS_ROTATIONAL_AXES
     bool cartesian_move = true;       // True if linear motion of the tool centerpoint relative to the workpiece occurs.
                                       // False if no movement of the tool center point relative to the work piece occurs
@@ -454,9 +486,10 @@ class Planner {
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
-    static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
-                            block_buffer_nonbusy,   // Index of the first non busy block
-                            block_buffer_tail;      // Index of the busy block, if any
+    static volatile block_index_t block_buffer_head,    // Index of the next block to be pushed
+                                  block_buffer_nonbusy, // Index of the first non busy block
+                                  block_buffer_tail;    // Index of the busy block, if any
+    static block_index_t block_buffer_planned;          // Index of the last block the forward pass doesn't need to revisit
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
@@ -602,6 +635,11 @@ class Planner {
       volatile static uint32_t block_buffer_runtime_us; // Theoretical block buffer runtime in µs
     #endif
 
+    #if ENABLED(SD_MOVE_PREVIEW)
+      // Speed² the newest block would have to end at without the SD preview, or 0 if it didn't use it
+      static float preview_stop_speed_sqr;
+    #endif
+
   public:
 
     /**
@@ -825,23 +863,24 @@ class Planner {
     #endif // HAS_POSITION_MODIFIERS
 
     // Number of moves currently in the planner including the busy block, if any
-    FORCE_INLINE static uint8_t movesplanned() { return block_dec_mod(block_buffer_head, block_buffer_tail); }
+    FORCE_INLINE static block_index_t movesplanned() { return block_dec_mod(block_buffer_head, block_buffer_tail); }
 
     // Number of nonbusy moves currently in the planner
-    FORCE_INLINE static uint8_t nonbusy_movesplanned() { return block_dec_mod(block_buffer_head, block_buffer_nonbusy); }
+    FORCE_INLINE static block_index_t nonbusy_movesplanned() { return block_dec_mod(block_buffer_head, block_buffer_nonbusy); }
 
     // Remove all blocks from the buffer
     FORCE_INLINE static void clear_block_buffer() {
       block_buffer_tail = 0;
       block_buffer_head = 0;
       block_buffer_nonbusy = 0;
+      block_buffer_planned = 0;
     }
 
     // Check if movement queue is full
     FORCE_INLINE static bool is_full() { return block_buffer_tail == next_block_index(block_buffer_head); }
 
     // Get count of movement slots free
-    FORCE_INLINE static uint8_t moves_free() { return (BLOCK_BUFFER_SIZE) - 1 - movesplanned(); }
+    FORCE_INLINE static block_index_t moves_free() { return (BLOCK_BUFFER_SIZE) - 1 - movesplanned(); }
 
     /**
      * @fn Planner::get_next_free_block
@@ -851,7 +890,7 @@ class Planner {
      *
      * @return  The first head block
      */
-    FORCE_INLINE static block_t* get_next_free_block(uint8_t &next_buffer_head, const uint8_t count=1) {
+    FORCE_INLINE static block_t* get_next_free_block(block_index_t &next_buffer_head, const block_index_t count=1) {
 
       // Wait until there are enough slots free
       while (moves_free() < count) { idle(); }
@@ -959,6 +998,27 @@ class Planner {
       , const PlannerHints &hints=PlannerHints()
     );
 
+    #if IS_KINEMATIC
+      /**
+       * @fn Planner::buffer_kinematic_segment
+       *
+       * @brief Add a new linear movement to the buffer.
+       * @details The kinematic target is already in 'delta', including E.
+       *          Used by buffer_line and by callers that batch the kinematics.
+       *
+       * @param cart      Cartesian target of the same move, in mm or degrees
+       * @param fr_mm_s   (Target) speed of the move (mm/s)
+       * @param extruder  Optional target extruder (otherwise active_extruder)
+       * @param hints     Optional parameters to aid planner calculations
+       *
+       * @return  false if no segment was queued due to cleaning, cold extrusion, full queue, etc...
+       */
+      static bool buffer_kinematic_segment(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
+        , const uint8_t extruder=active_extruder
+        , const PlannerHints &hints=PlannerHints()
+      );
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -1015,6 +1075,11 @@ class Planner {
     // a Full Shutdown is required, or when endstops are hit)
     static void quick_stop();
 
+    #if ENABLED(SD_MOVE_PREVIEW)
+      // Plan the newest block to end in a stop if it counted on the previewed SD moves
+      static void plan_tail_stop();
+    #endif
+
     #if ENABLED(REALTIME_REPORTING_COMMANDS)
       // Force a quick pause of the machine (e.g., when a pause is required in the middle of move).
       // NOTE: Hard-stops will lose steps so encoders are highly recommended if using these!
@@ -1062,7 +1127,7 @@ class Planner {
      *
      * WARNING: Called from Stepper ISR context!
      */
-    static block_t* get_future_block(const uint8_t offset);
+    static block_t* get_future_block(const block_index_t offset);
 
     /**
      * "Release" the current block so its slot can be reused.
@@ -1106,8 +1171,8 @@ class Planner {
     /**
      * Get the index of the next / previous block in the ring buffer
      */
-    static constexpr uint8_t next_block_index(const uint8_t block_index) { return block_inc_mod(block_index, 1); }
-    static constexpr uint8_t prev_block_index(const uint8_t block_index) { return block_dec_mod(block_index, 1); }
+    static constexpr block_index_t next_block_index(const block_index_t block_index) { return block_inc_mod(block_index, 1); }
+    static constexpr block_index_t prev_block_index(const block_index_t block_index) { return block_dec_mod(block_index, 1); }
 
     /**
      * Calculate the maximum allowable speed squared at this point, in order
@@ -1162,6 +1227,15 @@ class Planner {
         return limit_value;
       }
 
+      #if ENABLED(ARC_NATIVE_BLOCKS)
+        // Replace the plane components of a move vector with the arc tangent at the given angle
+        FORCE_INLINE static void set_arc_tangent(xyze_float_t &vector, const block_arc_t &arc, const_float_t angle) {
+          const float plane_mm = arc.angular_travel * arc.radius; // Signed, so CW arcs get the reverse tangent
+          vector[arc.axis_p] = -plane_mm * sin(angle);
+          vector[arc.axis_q] = plane_mm * cos(angle);
+        }
+      #endif
+
     #endif // HAS_JUNCTION_DEVIATION
 };
 
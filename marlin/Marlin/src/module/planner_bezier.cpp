@@ -37,6 +37,10 @@
 #include "../MarlinCore.h"
 #include "../gcode/queue.h"
 
+#ifdef CURVE_MAX_DEVIATION
+  #include "../libs/tessellate.h"
+#endif
+
 // See the meaning in the documentation of cubic_b_spline().
 #define MIN_STEP 0.002f
 #define MAX_STEP 0.1f
@@ -104,6 +108,9 @@ static inline float dist1(const_float_t x1, const_float_t y1, const_float_t x2,
  * estimates; however, given the improbability of such configurations,
  * the mitigation offered by MIN_STEP and the small computational
  * power available on Arduino, I think it is not wise to implement it.
+ *
+ * With CURVE_MAX_DEVIATION the steps come from BezierTessellator instead,
+ * which bounds the chord error using the curve's second derivative.
  */
 void cubic_b_spline(
   const xyze_pos_t &position,       // current position
@@ -117,7 +124,11 @@ void cubic_b_spline(
 
   xyze_pos_t bez_target;
   bez_target.set(position.x, position.y);
-  float step = MAX_STEP;
+  #ifdef CURVE_MAX_DEVIATION
+    const BezierTessellator bez({ position.x, position.y }, first, second, { target.x, target.y });
+  #else
+    float step = MAX_STEP;
+  #endif
 
   millis_t next_idle_ms = millis() + 200UL;
 
@@ -133,54 +144,66 @@ void cubic_b_spline(
       idle();
     }
 
-    // First try to reduce the step in order to make it sufficiently
-    // close to a linear interpolation.
-    bool did_reduce = false;
-    float new_t = t + step;
-    NOMORE(new_t, 1);
-    float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
-          new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
-    for (;;) {
-      if (new_t - t < (MIN_STEP)) break;
-      const float candidate_t = 0.5f * (t + new_t),
-                  candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + new_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + new_pos1);
-      if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-      did_reduce = true;
-    }
+    #ifdef CURVE_MAX_DEVIATION
 
-    // If we did not reduce the step, maybe we should enlarge it.
-    if (!did_reduce) for (;;) {
-      if (new_t - t > MAX_STEP) break;
-      const float candidate_t = t + 2 * (new_t - t);
-      if (candidate_t >= 1) break;
-      const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
-      if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-    }
+      // Take the longest step that keeps the chord within CURVE_MAX_DEVIATION of the curve
+      const float new_t = bez.next(t, CURVE_MAX_DEVIATION, MIN_STEP);
+      const xy_pos_t new_pos = bez.eval(new_t);
+      const float new_pos0 = new_pos.x, new_pos1 = new_pos.y;
+
+    #else
 
-    // Check some postcondition; they are disabled in the actual
-    // Marlin build, but if you test the same code on a computer you
-    // may want to check they are respect.
-    /*
-      assert(new_t <= 1.0);
-      if (new_t < 1.0) {
-        assert(new_t - t >= (MIN_STEP) / 2.0);
-        assert(new_t - t <= (MAX_STEP) * 2.0);
+      // First try to reduce the step in order to make it sufficiently
+      // close to a linear interpolation.
+      bool did_reduce = false;
+      float new_t = t + step;
+      NOMORE(new_t, 1);
+      float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
+            new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
+      for (;;) {
+        if (new_t - t < (MIN_STEP)) break;
+        const float candidate_t = 0.5f * (t + new_t),
+                    candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
+                    candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
+                    interp_pos0 = 0.5f * (bez_target.x + new_pos0),
+                    interp_pos1 = 0.5f * (bez_target.y + new_pos1);
+        if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
+        new_t = candidate_t;
+        new_pos0 = candidate_pos0;
+        new_pos1 = candidate_pos1;
+        did_reduce = true;
       }
-    */
 
-    hints.millimeters = new_t - t;
+      // If we did not reduce the step, maybe we should enlarge it.
+      if (!did_reduce) for (;;) {
+        if (new_t - t > MAX_STEP) break;
+        const float candidate_t = t + 2 * (new_t - t);
+        if (candidate_t >= 1) break;
+        const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
+                    candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
+                    interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
+                    interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
+        if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
+        new_t = candidate_t;
+        new_pos0 = candidate_pos0;
+        new_pos1 = candidate_pos1;
+      }
+
+      // Check some postcondition; they are disabled in the actual
+      // Marlin build, but if you test the same code on a computer you
+      // may want to check they are respect.
+      /*
+        assert(new_t <= 1.0);
+        if (new_t < 1.0) {
+          assert(new_t - t >= (MIN_STEP) / 2.0);
+          assert(new_t - t <= (MAX_STEP) * 2.0);
+        }
+      */
+
+      hints.millimeters = new_t - t;
+
+    #endif
+
     t = new_t;
 
     // Compute and send new position
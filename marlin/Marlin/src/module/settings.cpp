@@ -748,7 +748,11 @@ void MarlinSettings::postprocess() {
 
   TERN_(ENABLE_LEVELING_FADE_HEIGHT, set_z_fade_height(new_z_fade_height, false)); // false = no report
 
-  TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+  #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+    bedlevel.refresh_bed_level();
+  #elif ENABLED(MESH_CELL_COEFFICIENTS)
+    mesh_cells.refresh();
+  #endif
 
   TERN_(HAS_MOTOR_CURRENT_PWM, stepper.refresh_motor_power());
 
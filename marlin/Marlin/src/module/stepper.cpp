@@ -144,6 +144,10 @@ Stepper stepper; // Singleton
   #include "../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(STEPPER_ISR_PROFILE)
+  #include "../feature/isr_profile.h"
+#endif
+
 #if ENABLED(I2S_STEPPER_STREAM)
   #include "../HAL/ESP32/i2s.h"
 #endif
@@ -294,6 +298,12 @@ uint32_t Stepper::advance_divisor = 0,
   page_step_state_t Stepper::page_step_state;
 #endif
 
+#if ENABLED(LASER_RASTER)
+  bool Stepper::raster_active; // = false
+  uint16_t Stepper::raster_pixel;
+  uint32_t Stepper::raster_next_step, Stepper::raster_q, Stepper::raster_r, Stepper::raster_rem;
+#endif
+
 hal_timer_t Stepper::ticks_nominal = 0;
 #if DISABLED(S_CURVE_ACCELERATION)
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
@@ -1511,6 +1521,7 @@ HAL_STEP_TIMER_ISR() {
 #endif
 
 void Stepper::isr() {
+  TERN_(STEPPER_ISR_PROFILE, ISRProfile::Probe isr_probe(ISR_TOTAL));
 
   static hal_timer_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
@@ -1738,6 +1749,10 @@ void Stepper::isr() {
  * is to keep pulse timing as regular as possible.
  */
 void Stepper::pulse_phase_isr() {
+  #ifdef LINUX_BENCHMARK
+    Benchmark::Probe pulse_probe(Benchmark::PULSE_PHASE);
+  #endif
+  TERN_(STEPPER_ISR_PROFILE, ISRProfile::Probe isr_probe(ISR_PULSE));
 
   // If we must abort the current block, do so!
   if (abort_current_block) {
@@ -2138,6 +2153,7 @@ void Stepper::pulse_phase_isr() {
 #if HAS_ZV_SHAPING
 
   void Stepper::shaping_isr() {
+    TERN_(STEPPER_ISR_PROFILE, ISRProfile::Probe isr_probe(ISR_SHAPING));
     AxisFlags step_needed{0};
 
     // Clear the echoes that are ready to process. If the buffers are too full and risk overflow, also apply echoes early.
@@ -2395,6 +2411,11 @@ void Stepper::set_axis_moved_for_current_block() {
  * have been done, so it is less time critical.
  */
 hal_timer_t Stepper::block_phase_isr() {
+  #ifdef LINUX_BENCHMARK
+    Benchmark::Probe block_probe(Benchmark::BLOCK_PHASE);
+  #endif
+  TERN_(STEPPER_ISR_PROFILE, ISRProfile::Probe isr_probe(ISR_BLOCK));
+
   #if DISABLED(OLD_ADAPTIVE_MULTISTEPPING)
     // If the ISR uses < 50% of MPU time, halve multi-stepping
     const hal_timer_t time_spent = HAL_timer_get_count(MF_TIMER_STEP);
@@ -2607,6 +2628,25 @@ hal_timer_t Stepper::block_phase_isr() {
         // The timer interval is just the nominal value for the nominal speed
         interval = ticks_nominal;
       }
+
+      #if ENABLED(LASER_RASTER)
+        // Move on to the pixel for the current step event
+        if (raster_active && step_events_completed >= raster_next_step) {
+          const uint16_t last = current_block->laser.raster_count - 1;
+          while (raster_pixel < last && step_events_completed >= raster_next_step) {
+            raster_pixel++;
+            raster_next_step += raster_q;
+            raster_rem += raster_r;
+            if (raster_rem >= current_block->laser.raster_count) {
+              raster_rem -= current_block->laser.raster_count;
+              raster_next_step++;
+            }
+          }
+          if (raster_pixel == last) raster_next_step = UINT32_MAX;
+          const uint8_t px = laser_raster.pixels[current_block->laser.raster_buffer][raster_pixel];
+          cutter.apply_power((uint16_t(px) * (current_block->laser.power + 1)) >> 8);
+        }
+      #endif
     }
 
     #if ENABLED(LASER_FEATURE)
@@ -2804,6 +2844,21 @@ hal_timer_t Stepper::block_phase_isr() {
               cutter.apply_power(current_block->laser.status.isPowered ? current_block->laser.power : 0);
             #endif
           }
+
+          #if ENABLED(LASER_RASTER)
+            // Spread the pixels evenly over the step events, starting with the first pixel
+            const uint16_t pixels = current_block->laser.raster_count;
+            raster_active = pixels && current_block->laser.status.isEnabled && current_block->laser.status.isPowered;
+            if (raster_active) {
+              raster_pixel = 0;
+              raster_q = step_event_count / pixels;
+              raster_r = step_event_count % pixels;
+              raster_next_step = raster_q;
+              raster_rem = raster_r;
+              const uint8_t * const px = laser_raster.pixels[current_block->laser.raster_buffer];
+              cutter.apply_power((uint16_t(px[0]) * (current_block->laser.power + 1)) >> 8);
+            }
+          #endif
         }
       #endif // LASER_FEATURE
 
@@ -2867,6 +2922,10 @@ hal_timer_t Stepper::block_phase_isr() {
         #endif
       #endif
     }
+
+    #ifdef LINUX_BENCHMARK
+      Benchmark::block_fetched(current_block != nullptr);
+    #endif
   } // !current_block
 
   // Return the interval to wait
@@ -2933,7 +2992,7 @@ hal_timer_t Stepper::block_phase_isr() {
     #endif // INPUT_SHAPING_E_SYNC
 
     float lookahead(uint32_t t) {
-      for (uint8_t i = 0; block_t *block = Planner::get_future_block(i); i++) {
+      for (block_index_t i = 0; block_t *block = Planner::get_future_block(i); i++) {
         if (block->is_sync()) continue;
         if (t <= block->acceleration_time) {
           if (!block->use_advance_lead) return 0.0f;
@@ -3029,6 +3088,7 @@ hal_timer_t Stepper::block_phase_isr() {
 
   // Timer interrupt for E. LA_steps is set in the main routine
   void Stepper::advance_isr() {
+    TERN_(STEPPER_ISR_PROFILE, ISRProfile::Probe isr_probe(ISR_ADVANCE));
     // Apply Bresenham algorithm so that linear advance can piggy back on
     // the acceleration and speed values calculated in block_phase_isr().
     // This helps keep LA in sync with, for example, S_CURVE_ACCELERATION.
@@ -3533,19 +3593,31 @@ void Stepper::report_positions() {
    * - Set ftMotion.sts_stepperBusy state to reflect whether there are any commands in the circular buffer.
    * - If there are no commands in the buffer, return.
    * - Get the next command from the circular buffer ftMotion.stepperCmdBuff[].
+   *   With FTM_PACKED_COMMANDS each buffer entry is expanded over FTM_STEPS_PER_UNIT_TIME calls.
    * - If the block is being aborted, return without processing the command.
    * - Apply STEP/DIR along with any delays required. A command may be empty, with no STEP/DIR.
    */
   void Stepper::ftMotion_stepper() {
 
-    // Check if the buffer is empty.
-    ftMotion.sts_stepperBusy = (ftMotion.stepperCmdBuff_produceIdx != ftMotion.stepperCmdBuff_consumeIdx);
-    if (!ftMotion.sts_stepperBusy) return;
+    #if ENABLED(FTM_PACKED_COMMANDS)
+
+      // Expand the next tick from the packed commands, if any
+      ft_command_t command;
+      ftMotion.sts_stepperBusy = ftMotion.unpack_command(command);
+      if (!ftMotion.sts_stepperBusy) return;
 
-    // "Pop" one command from current motion buffer
-    const ft_command_t command = ftMotion.stepperCmdBuff[ftMotion.stepperCmdBuff_consumeIdx];
-    if (++ftMotion.stepperCmdBuff_consumeIdx == (FTM_STEPPERCMD_BUFF_SIZE))
-      ftMotion.stepperCmdBuff_consumeIdx = 0;
+    #else
+
+      // Check if the buffer is empty.
+      ftMotion.sts_stepperBusy = (ftMotion.stepperCmdBuff_produceIdx != ftMotion.stepperCmdBuff_consumeIdx);
+      if (!ftMotion.sts_stepperBusy) return;
+
+      // "Pop" one command from current motion buffer
+      const ft_command_t command = ftMotion.stepperCmdBuff[ftMotion.stepperCmdBuff_consumeIdx];
+      if (++ftMotion.stepperCmdBuff_consumeIdx == (FTM_STEPPERCMD_BUFF_SIZE))
+        ftMotion.stepperCmdBuff_consumeIdx = 0;
+
+    #endif
 
     if (abort_current_block) return;
 
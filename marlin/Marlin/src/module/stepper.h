@@ -55,6 +55,10 @@
   #include "ft_types.h"
 #endif
 
+#if ENABLED(LASER_RASTER)
+  #include "../feature/laser_raster.h"
+#endif
+
 // TODO: Review and ensure proper handling for special E axes with commands like M17/M18, stepper timeout, etc.
 #if ENABLED(MIXING_EXTRUDER)
   #define E_STATES EXTRUDERS  // All steppers are set together for each mixer. (Currently limited to 1.)
@@ -479,6 +483,14 @@ class Stepper {
       static page_step_state_t page_step_state;
     #endif
 
+    #if ENABLED(LASER_RASTER)
+      static bool raster_active;                // Current block is a powered raster move
+      static uint16_t raster_pixel;             // Pixel now being burned
+      static uint32_t raster_next_step,         // Step event that starts the next pixel
+                      raster_q, raster_r,       // Steps per pixel as quotient and remainder
+                      raster_rem;               // Remainder carried to the next pixel
+    #endif
+
     static hal_timer_t ticks_nominal;
     #if DISABLED(S_CURVE_ACCELERATION)
       static uint32_t acc_step_rate; // needed for deceleration start point
@@ -582,6 +594,10 @@ class Stepper {
       #if ENABLED(DIRECT_STEPPING)
         if (current_block->is_page()) page_manager.free_page(current_block->page_idx);
       #endif
+      #if ENABLED(LASER_RASTER)
+        if (current_block->laser.raster_count) laser_raster.free();
+        raster_active = false;
+      #endif
       current_block = nullptr;
       axis_did_move.reset();
       planner.release_current_block();
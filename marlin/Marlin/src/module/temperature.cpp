@@ -212,6 +212,10 @@
   #include "../feature/filwidth.h"
 #endif
 
+#if ENABLED(TELEMETRY_RECORDER)
+  #include "../feature/telemetry.h"
+#endif
+
 #if HAS_POWER_MONITOR
   #include "../feature/power_monitor.h"
 #endif
@@ -242,10 +246,16 @@
 #endif
 
 #if HAS_HOTEND_THERMISTOR
-  #define NEXT_TEMPTABLE(N) ,TEMPTABLE_##N
-  #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
-  static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
-  static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  #if ENABLED(UNIFORM_THERMISTOR_TABLES)
+    #define _UNIFORM_TEMPTABLE(N) TERN(TEMP_SENSOR_##N##_IS_THERMISTOR, (&uniform_temptable<TEMPTABLE_##N##_LEN, TEMPTABLE_##N>), nullptr)
+    #define NEXT_UNIFORM_TEMPTABLE(N) ,_UNIFORM_TEMPTABLE(N)
+    static const uniform_temptable_t* const heater_utbl_map[HOTENDS] = ARRAY_BY_HOTENDS(_UNIFORM_TEMPTABLE(0) REPEAT_S(1, HOTENDS, NEXT_UNIFORM_TEMPTABLE));
+  #else
+    #define NEXT_TEMPTABLE(N) ,TEMPTABLE_##N
+    #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
+    static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
+    static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  #endif
 #endif
 
 Temperature thermalManager;
@@ -2374,6 +2384,25 @@ void Temperature::task() {
 // For a 5V input the AD8495 returns a value scaled with 5mV per °C. (Minimum input voltage is 2.7V.)
 #define TEMP_AD8495(RAW) ((RAW) * (ADC_VREF_MV /  5) / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD8495_GAIN) + TEMP_SENSOR_AD8495_OFFSET)
 
+#if ENABLED(UNIFORM_THERMISTOR_TABLES)
+
+/**
+ * Index the uniform table by the 'raw' value, then interpolate
+ * proportionally within the segment.
+ */
+#define LOOKUP_UNIFORM_TEMPTABLE(UTBL) do{                                \
+  const uint16_t r = _MIN(raw, MAX_RAW_THERMISTOR_VALUE),                 \
+                 i = r / UNIFORM_TEMPTABLE_STEP,                          \
+                 f = r % UNIFORM_TEMPTABLE_STEP;                          \
+  const int16_t t0 = int16_t(pgm_read_word(&(UTBL).t16[i])),              \
+                t1 = int16_t(pgm_read_word(&(UTBL).t16[i + 1]));          \
+  return (t0 + (t1 - t0) * (f * (1.0f / UNIFORM_TEMPTABLE_STEP))) * (1.0f / 16); \
+}while(0)
+
+#define SCAN_THERMISTOR_TABLE(TBL,LEN) LOOKUP_UNIFORM_TEMPTABLE((uniform_temptable<LEN, TBL>))
+
+#else
+
 /**
  * Bisect search for the range of the 'raw' value, then interpolate
  * proportionally between the under and over values.
@@ -2396,6 +2425,8 @@ void Temperature::task() {
   }                                                                       \
 }while(0)
 
+#endif // !UNIFORM_THERMISTOR_TABLES
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load
@@ -2638,8 +2669,12 @@ void Temperature::task() {
 
     #if HAS_HOTEND_THERMISTOR
       // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #if ENABLED(UNIFORM_THERMISTOR_TABLES)
+        LOOKUP_UNIFORM_TEMPTABLE(*heater_utbl_map[e]);
+      #else
+        const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+        SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #endif
     #endif
 
     return 0;
@@ -2829,6 +2864,7 @@ void Temperature::updateTemperaturesFromRawValues() {
 
   TERN_(FILAMENT_WIDTH_SENSOR, filwidth.update_measured_mm());
   TERN_(HAS_POWER_MONITOR,     power_monitor.capture_values());
+  TERN_(TELEMETRY_RECORDER,    telemetry.update_temps());
 
   #if HAS_HOTEND
     #define _TEMPDIR(N) TEMP_SENSOR_IS_ANY_MAX_TC(N) ? 0 : TEMPDIR(N),
@@ -4500,6 +4536,9 @@ void Temperature::isr() {
   // Check fan tachometers
   TERN_(HAS_FANCHECK, fan_check.update_tachometers());
 
+  // Record a telemetry sample, if due
+  TERN_(TELEMETRY_RECORDER, telemetry.isr());
+
   // Poll endstops state, if required
   endstops.poll();
 
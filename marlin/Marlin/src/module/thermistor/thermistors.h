@@ -360,6 +360,44 @@ static_assert(255 > TEMPTABLE_0_LEN || 255 > TEMPTABLE_1_LEN || 255 > TEMPTABLE_
   , "Temperature conversion tables over 255 entries need special consideration."
 );
 
+#if ENABLED(UNIFORM_THERMISTOR_TABLES)
+
+  /**
+   * Uniform tables are a thermistor table resampled at evenly spaced raw values,
+   * so a reading converts with one index and one interpolation. Temperatures are
+   * stored in 1/16 °C so interpolated values keep their fractional part.
+   */
+  #define UNIFORM_TEMPTABLE_STEP ((MAX_RAW_THERMISTOR_VALUE + 1UL) / (UNIFORM_THERMISTOR_SEGMENTS))
+  static_assert(UNIFORM_TEMPTABLE_STEP > 1 && !(UNIFORM_TEMPTABLE_STEP & (UNIFORM_TEMPTABLE_STEP - 1)),
+    "UNIFORM_THERMISTOR_SEGMENTS is too large for the ADC range.");
+
+  typedef struct { int16_t t16[(UNIFORM_THERMISTOR_SEGMENTS) + 1]; } uniform_temptable_t;
+
+  // Resample with the same interpolation and end clamping as SCAN_THERMISTOR_TABLE
+  template<size_t LEN>
+  constexpr uniform_temptable_t make_uniform_temptable(const temp_entry_t (&tbl)[LEN]) {
+    uniform_temptable_t u{};
+    size_t m = 1;
+    for (uint16_t i = 0; i <= (UNIFORM_THERMISTOR_SEGMENTS); ++i) {
+      const uint32_t raw = i * UNIFORM_TEMPTABLE_STEP;
+      float c = tbl[LEN - 1].celsius;
+      if (raw <= tbl[0].value)
+        c = tbl[0].celsius;
+      else if (raw < tbl[LEN - 1].value) {
+        while (raw > tbl[m].value) ++m;
+        c = tbl[m - 1].celsius + (raw - tbl[m - 1].value) * float(tbl[m].celsius - tbl[m - 1].celsius) / float(tbl[m].value - tbl[m - 1].value);
+      }
+      u.t16[i] = int16_t(c * 16 + (c < 0 ? -0.5f : 0.5f));
+    }
+    return u;
+  }
+
+  // One copy per thermistor table, shared by all sensors that use it
+  template<size_t LEN, const temp_entry_t (&TBL)[LEN]>
+  constexpr uniform_temptable_t uniform_temptable PROGMEM = make_uniform_temptable(TBL);
+
+#endif
+
 // Set the high and low raw values for the heaters
 // For thermistors the highest temperature results in the lowest ADC value
 // For thermocouples the highest temperature results in the highest ADC value
@@ -1415,6 +1415,71 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
   return nbyte;
 }
 
+/**
+ * Read whole blocks from a file starting at the current position.
+ * Blocks in the same cluster are contiguous on the device, so they
+ * are fetched with a single multiple-block read sequence.
+ *
+ * \param[out] dst Pointer to the location that will receive the data.
+ *
+ * \param[in] count Maximum number of 512 byte blocks to read.
+ *
+ * \return For success readBlocks() returns the number of blocks read,
+ * which may be less than \a count at the end of a cluster. Zero is
+ * returned if the position is not block-aligned or if less than one
+ * block remains in the file. If an error occurs readBlocks() returns -1.
+ */
+int16_t SdBaseFile::readBlocks(uint8_t * const dst, const uint8_t count) {
+  // error if not open or write only
+  if (!isOpen() || !(flags_ & O_READ)) return -1;
+
+  // only whole blocks
+  if (curPosition_ & 0x1FF) return 0;
+  uint32_t n = (fileSize_ - curPosition_) >> 9;
+  NOMORE(n, count);
+  if (n == 0) return 0;
+
+  uint32_t block;  // raw device block number
+  if (type_ == FAT_FILE_TYPE_ROOT_FIXED) {
+    block = vol_->rootDirStart() + (curPosition_ >> 9);
+  }
+  else {
+    const uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+    if (blockOfCluster == 0) {
+      // start of new cluster
+      if (curPosition_ == 0)
+        curCluster_ = firstCluster_;                      // use first cluster in file
+      else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+        return -1;
+    }
+    block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+
+    // don't run past the end of the cluster
+    NOMORE(n, uint32_t(vol_->blocksPerCluster() - blockOfCluster));
+  }
+
+  // write back the cache if it holds a block in the range
+  if (vol_->cacheBlockNumber() - block < n && !vol_->cacheFlush()) return -1;
+
+  if (n == 1) {
+    if (!vol_->readBlock(block, dst)) return -1;
+  }
+  else {
+    DiskIODriver * const dev = vol_->sdCard();
+    if (!dev->readStart(block)) return -1;
+    for (uint32_t i = 0; i < n; ++i) {
+      if (!dev->readData(dst + (i << 9))) {
+        dev->readStop();
+        return -1;
+      }
+    }
+    if (!dev->readStop()) return -1;
+  }
+
+  curPosition_ += n << 9;
+  return n;
+}
+
 /**
  * Read the next entry in a directory.
  *
@@ -2269,4 +2334,107 @@ int16_t SdBaseFile::write(const void *buf, const uint16_t nbyte) {
   return -1;
 }
 
+/**
+ * Write whole blocks to a file starting at the current position.
+ * Blocks in the same cluster are contiguous on the device, so they are
+ * written with a single multiple-block write sequence, telling the card
+ * how many blocks to pre-erase.
+ *
+ * \param[in] src Pointer to the location of the data to be written.
+ *
+ * \param[in] count Maximum number of 512 byte blocks to write.
+ *
+ * \return For success writeBlocks() returns the number of blocks written,
+ * which may be less than \a count at the end of a cluster. Zero is
+ * returned if the position is not block-aligned. If an error occurs
+ * writeBlocks() returns -1.
+ */
+int16_t SdBaseFile::writeBlocks(const uint8_t * const src, const uint8_t count) {
+  #if ENABLED(SDCARD_READONLY)
+    writeError = true; return -1;
+  #endif
+
+  uint8_t blockOfCluster;
+  uint32_t block, n;
+
+  // error if not a normal file or is read-only
+  if (!isFile() || !(flags_ & O_WRITE)) goto FAIL;
+
+  // seek to end of file if append flag
+  if ((flags_ & O_APPEND) && curPosition_ != fileSize_) {
+    if (!seekEnd()) goto FAIL;
+  }
+
+  // only whole blocks
+  if ((curPosition_ & 0x1FF) || count == 0) return 0;
+
+  blockOfCluster = vol_->blockOfCluster(curPosition_);
+  if (blockOfCluster == 0) {
+    // start of new cluster
+    if (curCluster_ == 0) {
+      if (firstCluster_ == 0) {
+        // allocate first cluster of file
+        if (!addCluster()) goto FAIL;
+      }
+      else {
+        curCluster_ = firstCluster_;
+      }
+    }
+    else {
+      uint32_t next;
+      if (!vol_->fatGet(curCluster_, &next)) goto FAIL;
+      if (vol_->isEOC(next)) {
+        // add cluster if at end of chain
+        if (!addCluster()) goto FAIL;
+      }
+      else {
+        curCluster_ = next;
+      }
+    }
+  }
+  block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+
+  // don't run past the end of the cluster
+  n = _MIN(uint32_t(count), uint32_t(vol_->blocksPerCluster() - blockOfCluster));
+
+  // invalidate cache if it holds a block in the range
+  if (vol_->cacheBlockNumber() - block < n) vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
+
+  if (n == 1) {
+    if (!vol_->writeBlock(block, src)) goto FAIL;
+  }
+  else {
+    DiskIODriver * const dev = vol_->sdCard();
+    if (!dev->writeStart(block, n)) goto FAIL;
+    for (uint32_t i = 0; i < n; ++i) {
+      if (!dev->writeData(src + (i << 9))) {
+        dev->writeStop();
+        goto FAIL;
+      }
+    }
+    if (!dev->writeStop()) goto FAIL;
+  }
+
+  curPosition_ += n << 9;
+  if (curPosition_ > fileSize_) {
+    // update fileSize and insure sync will update dir entry
+    fileSize_ = curPosition_;
+    flags_ |= F_FILE_DIR_DIRTY;
+  }
+  else if (dateTime_) {
+    // insure sync will update modified date and time
+    flags_ |= F_FILE_DIR_DIRTY;
+  }
+
+  if (flags_ & O_SYNC) {
+    if (!sync()) goto FAIL;
+  }
+  return n;
+
+  FAIL:
+  // return for write error
+  writeError = true;
+  return -1;
+}
+
 #endif // HAS_MEDIA
@@ -296,6 +296,7 @@ class SdBaseFile {
   bool printName();
   int16_t read();
   int16_t read(void * const buf, uint16_t nbyte);
+  int16_t readBlocks(uint8_t * const dst, const uint8_t count);
   int8_t readDir(dir_t * const dir, char * const longFilename);
   static bool remove(SdBaseFile * const dirFile, const char * const path);
   bool remove();
@@ -345,6 +346,7 @@ class SdBaseFile {
    */
   SdVolume* volume() const { return vol_; }
   int16_t write(const void *buf, const uint16_t nbyte);
+  int16_t writeBlocks(const uint8_t * const src, const uint8_t count);
 
  private:
   friend class SdFat;           // allow SdFat to set cwd_
@@ -159,6 +159,14 @@ MediaFile CardReader::myfile;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  CardReader::readahead_t CardReader::readahead;
+#endif
+
+#if ENABLED(SD_HEATSHRINK)
+  HeatshrinkFile<MediaFile> CardReader::hs(CardReader::myfile, CardReader::sdpos, CardReader::filesize);
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -231,6 +239,11 @@ bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD,
     || fileIsBinary()                                   // BIN files are accepted
     || (!onlyBin && p.name[8] == 'G'
                  && p.name[9] != '~')                   // Non-backup *.G* files are accepted
+    #if ENABLED(SD_HEATSHRINK)
+      || (!onlyBin && p.name[8] == 'H'
+                   && p.name[9] == 'S'
+                   && p.name[10] == ' ')                // Compressed *.HS files are accepted
+    #endif
   );
 }
 
@@ -722,6 +735,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(DWIN_CREALITY_LCD, hmiFlag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
   if (isFileOpen()) myfile.close();
+  TERN_(SD_READ_AHEAD, readahead_reset());
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -836,6 +850,14 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (myfile.open(diveDir, fname, O_READ)) {
     filesize = myfile.fileSize();
     sdpos = 0;
+    TERN_(SD_READ_AHEAD, readahead_reset());
+    #if ENABLED(SD_HEATSHRINK)
+      if (!hs_open()) {
+        myfile.close();
+        return openFailed(fname);
+      }
+    #endif
+    TERN_(SD_MOVE_PREVIEW, sd_preview.reset());
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -858,9 +880,9 @@ inline void echo_write_to_file(const char * const fname) {
 }
 
 //
-// Open a file by DOS path for write
+// Open a file by DOS path for write, optionally keeping its contents to append
 //
-void CardReader::openFileWrite(const char * const path) {
+void CardReader::openFileWrite(const char * const path, const bool append/*=false*/) {
   if (!isMounted()) return;
 
   announceOpen(2, path);
@@ -873,7 +895,7 @@ void CardReader::openFileWrite(const char * const path) {
   if (!fname) return openFailed(path);
 
   #if DISABLED(SDCARD_READONLY)
-    if (myfile.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
+    if (myfile.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | (append ? 0 : O_TRUNC))) {
       flag.saving = true;
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
@@ -953,6 +975,132 @@ void CardReader::report_status(TERN_(QUIETER_AUTO_REPORT_SD_STATUS, const bool i
     SERIAL_ECHOLNPGM(STR_SD_NOT_PRINTING);
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Get the next byte of the file from the read-ahead ring.
+   * Refill the ring directly (and count a stall) if it ran dry.
+   */
+  int16_t CardReader::get() {
+    TERN_(SD_HEATSHRINK, if (flag.compressed) return hs.get());
+
+    if (!readahead.count) {
+      if (!readahead_fill()) return -1;
+      readahead.stalls++;
+    }
+    else if (!readahead.index)
+      readahead.hits++;
+
+    const uint8_t c = readahead.buffer[readahead.head][readahead.index];
+    if (++readahead.index >= readahead.length[readahead.head]) {
+      readahead.index = 0;
+      if (++readahead.head >= SD_READ_AHEAD_BLOCKS) readahead.head = 0;
+      readahead.count--;
+    }
+    sdpos = ++readahead.pos;
+    return c;
+  }
+
+  /**
+   * Fill empty slots of the read-ahead ring from the open file.
+   * Runs of whole blocks use a multiple-block read (e.g., CMD18), so
+   * one command fetches as many slots as are contiguous in the ring.
+   * A short read re-aligns the file to a block boundary after a seek.
+   * Return 'true' if the ring has any data.
+   */
+  bool CardReader::readahead_fill() {
+    if (!isFileOpen()) return false;
+
+    if (!readahead.count) {
+      readahead.head = readahead.index = 0;
+      readahead.pos = myfile.curPosition();
+    }
+
+    while (readahead.count < SD_READ_AHEAD_BLOCKS) {
+      uint8_t tail = readahead.head + readahead.count;
+      if (tail >= SD_READ_AHEAD_BLOCKS) tail -= SD_READ_AHEAD_BLOCKS;
+
+      // Free slots up to the physical end of the ring
+      const uint8_t slots = _MIN(SD_READ_AHEAD_BLOCKS - readahead.count, SD_READ_AHEAD_BLOCKS - tail);
+
+      const int16_t blocks = myfile.readBlocks(readahead.buffer[tail], slots);
+      if (blocks < 0) break;
+      if (blocks) {
+        for (uint8_t i = 0; i < blocks; ++i) readahead.length[tail + i] = 512;
+        readahead.count += blocks;
+        continue;
+      }
+
+      // Unaligned position or last partial block
+      const uint16_t want = 512 - (myfile.curPosition() & 0x1FF);
+      const int16_t got = myfile.read(readahead.buffer[tail], want);
+      if (got <= 0) break;
+      readahead.length[tail] = got;
+      readahead.count++;
+      if (uint16_t(got) < want) break;    // End of file
+    }
+
+    TERN_(SD_MOVE_PREVIEW, sd_preview.scan());
+
+    return readahead.count > 0;
+  }
+
+  /**
+   * Drop the read-ahead data, moving the file position back to the next
+   * byte get() would have returned, so direct reads resume from there.
+   */
+  void CardReader::readahead_discard() {
+    if (readahead.count) {
+      myfile.seekSet(readahead.pos);
+      readahead_reset();
+    }
+  }
+
+  #if ENABLED(SD_MOVE_PREVIEW)
+
+    /**
+     * Get the data in the read-ahead ring from a file position on, up to the
+     * end of its slot. Return nullptr if the position is not in the ring.
+     */
+    const uint8_t* CardReader::readahead_peek(const uint32_t pos, uint16_t &count) {
+      if (pos < readahead.pos) return nullptr;
+      uint32_t offset = pos - readahead.pos + readahead.index;
+      for (uint8_t n = 0, slot = readahead.head; n < readahead.count; ++n) {
+        const uint16_t len = readahead.length[slot];
+        if (offset < len) {
+          count = len - offset;
+          return &readahead.buffer[slot][offset];
+        }
+        offset -= len;
+        if (++slot >= SD_READ_AHEAD_BLOCKS) slot = 0;
+      }
+      return nullptr;
+    }
+
+  #endif
+
+  void CardReader::readahead_report() {
+    SERIAL_ECHOLNPGM("SD read-ahead blocks:", SD_READ_AHEAD_BLOCKS, " hits:", readahead.hits, " stalls:", readahead.stalls);
+  }
+
+#endif // SD_READ_AHEAD
+
+#if ENABLED(SD_HEATSHRINK)
+
+  /**
+   * Check the newly-opened file for a compressed file header.
+   * See libs/heatshrink/heatshrink_file.h for the format.
+   * Return 'false' for a compressed file the decoder can't read.
+   */
+  bool CardReader::hs_open() {
+    const int8_t status = hs.open();
+    if (status < 0) SERIAL_ECHO_MSG("Unsupported compressed file.");
+    flag.compressed = status > 0;
+    return status >= 0;
+  }
+
+#endif // SD_HEATSHRINK
+
 //
 // Write a command to the log file
 //
@@ -1100,6 +1248,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   myfile.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  TERN_(SD_READ_AHEAD, readahead_reset());
 
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
@@ -1537,6 +1686,7 @@ int16_t CardReader::get_num_items() {
 //
 void CardReader::fileHasFinished() {
   myfile.close();
+  TERN_(SD_READ_AHEAD, readahead_reset());
 
   #if HAS_MEDIA_SUBCALLS
     if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
@@ -75,6 +75,9 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1        // Use the serial line buffer as BinaryStream input
        #endif
+       #if ENABLED(SD_HEATSHRINK)
+         , compressed:1         // The open file is decompressed as it's read
+       #endif
     ;
 } card_flags_t;
 
@@ -93,6 +96,14 @@ enum SortFlag : int8_t { AS_REV = -1, AS_OFF, AS_FWD, AS_ALSO_REV };
   #include "../libs/autoreport.h"
 #endif
 
+#if ENABLED(SD_MOVE_PREVIEW)
+  #include "../feature/sd_preview.h"
+#endif
+
+#if ENABLED(SD_HEATSHRINK)
+  #include "../libs/heatshrink/heatshrink_file.h"
+#endif
+
 class CardReader {
 public:
   static card_flags_t flag;                         // Flags (above)
@@ -216,7 +227,7 @@ public:
 
   // Basic file ops
   static void openFileRead(const char * const path, const uint8_t subcall=0);
-  static void openFileWrite(const char * const path);
+  static void openFileWrite(const char * const path, const bool append=false);
   static void closefile(const bool store_location=false);
   static bool fileExists(const char * const name);
   static void removeFile(const char * const name);
@@ -247,7 +258,7 @@ public:
   static void abortFilePrintNow(TERN_(SD_RESORT, const bool re_sort=false));
   static void fileHasFinished();
   static void abortFilePrintSoon() { flag.abort_sd_printing = isFileOpen(); }
-  static void pauseSDPrint()       { flag.sdprinting = false; }
+  static void pauseSDPrint()       { flag.sdprinting = false; TERN_(SD_MOVE_PREVIEW, sd_preview.interrupt()); }
   static bool isPrinting()         { return flag.sdprinting; }
   static bool isStillPrinting()    { return flag.sdprinting && !flag.abort_sd_printing; }
   static bool isStillFetching()    { return isStillPrinting() && !flag.sdprintdone; }
@@ -314,10 +325,30 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)myfile.read(); sdpos = myfile.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return myfile.isOpen() ? myfile.read(buf, nbyte) : -1; }
+  #if ENABLED(SD_READ_AHEAD)
+    static int16_t get();
+    static int16_t read(void *buf, uint16_t nbyte)  { TERN_(SD_HEATSHRINK, if (flag.compressed) return hs.read(buf, nbyte)); readahead_discard(); return myfile.isOpen() ? myfile.read(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { TERN_(SD_HEATSHRINK, if (flag.compressed) return hs.seek(index)); readahead_reset(); myfile.seekSet((sdpos = index)); TERN_(SD_MOVE_PREVIEW, sd_preview.reset()); }
+
+    // Fill the read-ahead buffer while the main loop is waiting on something else
+    static void prefetch() { if (isStillFetching() && !TERN0(SD_HEATSHRINK, flag.compressed)) readahead_fill(); }
+
+    // Read-ahead statistics
+    static uint32_t readahead_hits()   { return readahead.hits; }   // Block changes served from RAM (stalls avoided)
+    static uint32_t readahead_stalls() { return readahead.stalls; } // Block changes that waited on the media
+    static void readahead_report();
+
+    #if ENABLED(SD_MOVE_PREVIEW)
+      static const uint8_t* readahead_peek(const uint32_t pos, uint16_t &count);
+    #endif
+  #else
+    static int16_t get()                            { TERN_(SD_HEATSHRINK, if (flag.compressed) return hs.get()); int16_t out = (int16_t)myfile.read(); sdpos = myfile.curPosition(); return out; }
+    static int16_t read(void *buf, uint16_t nbyte)  { TERN_(SD_HEATSHRINK, if (flag.compressed) return hs.read(buf, nbyte)); return myfile.isOpen() ? myfile.read(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { TERN_(SD_HEATSHRINK, if (flag.compressed) return hs.seek(index)); myfile.seekSet((sdpos = index)); }
+  #endif
   static int16_t write(void *buf, uint16_t nbyte) { return myfile.isOpen() ? myfile.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { myfile.seekSet((sdpos = index)); }
+  static int16_t writeBlocks(const uint8_t *buf, const uint8_t count) { return myfile.isOpen() ? myfile.writeBlocks(buf, count) : -1; }
+  static uint32_t getWriteSize() { return myfile.fileSize(); }
 
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     //
@@ -338,6 +369,39 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  //
+  // Read-ahead ring of whole media blocks
+  //
+  #if ENABLED(SD_READ_AHEAD)
+    typedef struct {
+      uint8_t buffer[SD_READ_AHEAD_BLOCKS][512];
+      uint16_t length[SD_READ_AHEAD_BLOCKS];  // Valid bytes in each slot (short at EOF or after a seek)
+      uint8_t head,                           // Slot being read by get()
+              count;                          // Number of filled slots, starting at head
+      uint16_t index;                         // Next byte in the head slot
+      uint32_t pos,                           // File position of the next byte in the ring
+               hits, stalls;
+    } readahead_t;
+    static readahead_t readahead;
+
+    static bool readahead_fill();
+    static void readahead_reset() { readahead.count = 0; }
+    static void readahead_discard();
+  #endif
+
+  //
+  // Heatshrink-compressed file (*.gcode.hs)
+  //
+  // The file has a header, then blocks of G-code compressed one at a time,
+  // each after its compressed size. An index of the block positions follows.
+  // 'filesize' and 'sdpos' count decompressed bytes, so seeking to 'sdpos'
+  // finds its block in the index and decompresses the block up to 'sdpos'.
+  //
+  #if ENABLED(SD_HEATSHRINK)
+    static HeatshrinkFile<MediaFile> hs;
+    static bool hs_open();
+  #endif
+
   //
   // Working directory and parents
   //
@@ -0,0 +1,169 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(SD_HEATSHRINK)
+
+#include "src/libs/heatshrink/heatshrink_file.h"
+
+#include <stdio.h>
+#include <vector>
+
+// A file in RAM with the calls HeatshrinkFile needs
+struct MemFile {
+  std::vector<uint8_t> data;
+  uint32_t pos = 0;
+
+  int16_t read(void *buf, const uint16_t nbyte) {
+    const uint16_t n = _MIN(uint32_t(nbyte), uint32_t(data.size()) - pos);
+    memcpy(buf, &data[pos], n);
+    pos += n;
+    return n;
+  }
+  bool seekSet(const uint32_t p) { if (p > data.size()) return false; pos = p; return true; }
+};
+
+// Heatshrink-encode a block the same way as gcode_heatshrink.py without the heatshrink module
+static void encode(const uint8_t *in, const uint16_t len, std::vector<uint8_t> &out) {
+  constexpr uint16_t window = _BV(HEATSHRINK_STATIC_WINDOW_BITS), longest = _BV(HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+  uint32_t acc = 0;
+  uint8_t nbits = 0;
+  auto put = [&](const uint16_t value, const uint8_t count) {
+    acc = (acc << count) | value;
+    for (nbits += count; nbits >= 8;) { nbits -= 8; out.push_back(acc >> nbits); }
+  };
+
+  for (uint16_t i = 0; i < len;) {
+    uint16_t best_len = 0, best_dist = 0;
+    for (uint16_t j = i > window ? i - window : 0; j < i; j++) {
+      uint16_t n = 0;
+      while (n < longest && i + n < len && in[j + n] == in[i + n]) n++;
+      if (n >= best_len) { best_len = n; best_dist = i - j; }
+    }
+    if (best_len >= 2) {
+      put(0, 1);
+      put(best_dist - 1, HEATSHRINK_STATIC_WINDOW_BITS);
+      put(best_len - 1, HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+      i += best_len;
+    }
+    else {
+      put(1, 1);
+      put(in[i++], 8);
+    }
+  }
+  if (nbits) out.push_back(acc << (8 - nbits));
+}
+
+// Build a compressed file with the header, the blocks, and the block index
+static MemFile compress(const std::vector<uint8_t> &plain, const uint8_t block_bits) {
+  auto put32 = [](std::vector<uint8_t> &v, const uint32_t n) { for (uint8_t i = 0; i < 32; i += 8) v.push_back(n >> i); };
+
+  MemFile file;
+  std::vector<uint8_t> &f = file.data;
+  f = { 'H', 'S', 'G', 'C', HEATSHRINK_STATIC_WINDOW_BITS, HEATSHRINK_STATIC_LOOKAHEAD_BITS, block_bits, 0 };
+  put32(f, plain.size());
+  put32(f, 0); // Index position, filled in below
+
+  std::vector<uint8_t> index;
+  const uint16_t block_size = _BV(block_bits);
+  for (uint32_t start = 0; start < plain.size(); start += block_size) {
+    put32(index, f.size());
+    std::vector<uint8_t> packed;
+    encode(&plain[start], _MIN(uint32_t(block_size), uint32_t(plain.size()) - start), packed);
+    f.push_back(packed.size() & 0xFF);
+    f.push_back(packed.size() >> 8);
+    f.insert(f.end(), packed.begin(), packed.end());
+  }
+  const uint32_t index_pos = f.size();
+  for (uint8_t i = 0; i < 4; i++) f[12 + i] = index_pos >> (i * 8);
+  f.insert(f.end(), index.begin(), index.end());
+  return file;
+}
+
+// G-code lines that repeat enough to compress
+static std::vector<uint8_t> gcode_lines(const uint32_t size) {
+  std::vector<uint8_t> out;
+  uint32_t seed = 12345;
+  char line[48];
+  while (out.size() < size) {
+    seed = seed * 1103515245 + 12345;
+    sprintf(line, "G1 X%u.%02u Y%u.%02u E%u.%04u\n", (seed >> 8) % 200, (seed >> 3) % 100, (seed >> 16) % 200, seed % 100, (seed >> 12) % 3, (seed >> 4) % 10000);
+    out.insert(out.end(), line, line + strlen(line));
+  }
+  out.resize(size);
+  return out;
+}
+
+MARLIN_TEST(heatshrink_file, plain_file_is_rewound) {
+  MemFile file;
+  const char text[] = "G28\nG1 X10 Y10\n";
+  file.data.assign(text, text + sizeof(text) - 1);
+  uint32_t pos = 0, size = file.data.size();
+  HeatshrinkFile<MemFile> hs(file, pos, size);
+  TEST_ASSERT_EQUAL(0, hs.open());
+  TEST_ASSERT_EQUAL(0, file.pos);
+}
+
+MARLIN_TEST(heatshrink_file, read_whole_file) {
+  const std::vector<uint8_t> plain = gcode_lines(10000);
+  MemFile file = compress(plain, 12);
+  uint32_t pos = 0, size = file.data.size();
+  HeatshrinkFile<MemFile> hs(file, pos, size);
+  TEST_ASSERT_EQUAL(1, hs.open());
+  TEST_ASSERT_EQUAL(plain.size(), size);
+  TEST_ASSERT_TRUE(file.data.size() < plain.size());
+
+  bool same = true;
+  for (uint32_t i = 0; i < plain.size(); i++) same &= hs.get() == plain[i];
+  TEST_ASSERT_TRUE(same);
+  TEST_ASSERT_EQUAL(plain.size(), pos);
+  TEST_ASSERT_EQUAL(-1, hs.get());
+}
+
+MARLIN_TEST(heatshrink_file, seek_round_trip) {
+  const std::vector<uint8_t> plain = gcode_lines(10000);
+  MemFile file = compress(plain, 12);
+  uint32_t pos = 0, size = 0;
+  HeatshrinkFile<MemFile> hs(file, pos, size);
+  TEST_ASSERT_EQUAL(1, hs.open());
+
+  // Forward into the second block, back to the end of the first, then forward again.
+  // Each seek comes part-way through reading a block, with input left in the decoder.
+  const uint32_t seeks[] = { 5000, 4095, 4096, 9000, 0, 8191, 3 };
+  for (const uint32_t to : seeks) {
+    hs.seek(to);
+    TEST_ASSERT_EQUAL(to, pos);
+    uint8_t got[100];
+    const int16_t n = hs.read(got, sizeof(got));
+    TEST_ASSERT_EQUAL(_MIN(uint32_t(sizeof(got)), uint32_t(plain.size()) - to), n);
+    TEST_ASSERT_TRUE(memcmp(got, &plain[to], n) == 0);
+    TEST_ASSERT_EQUAL(to + n, pos);
+  }
+
+  // Seeking to the end leaves nothing to read
+  hs.seek(plain.size());
+  TEST_ASSERT_EQUAL(plain.size(), pos);
+  TEST_ASSERT_EQUAL(-1, hs.get());
+}
+
+#endif // SD_HEATSHRINK
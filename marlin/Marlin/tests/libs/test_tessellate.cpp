@@ -0,0 +1,111 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include "src/libs/tessellate.h"
+
+#include <stdio.h>
+
+// Largest distance from the chord to the curve, sampled along the segment
+static float chord_error(const BezierTessellator &bez, const float t0, const float t1) {
+  const xy_pos_t a = bez.eval(t0), b = bez.eval(t1), ab = b - a;
+  const float len = ab.magnitude();
+  float worst = 0;
+  for (uint8_t i = 1; i < 32; i++) {
+    const xy_pos_t p = bez.eval(t0 + (t1 - t0) * i / 32.0f) - a;
+    const float d = len ? ABS(ab.x * p.y - ab.y * p.x) / len : p.magnitude();
+    NOLESS(worst, d);
+  }
+  return worst;
+}
+
+MARLIN_TEST(tessellate, arc_segments_for_deviation) {
+  // 90° of a 10mm radius within 5µm: each chord may span at most 3.62°
+  TEST_ASSERT_EQUAL(25, arc_segments_for_deviation(10, RADIANS(90), 0.005f));
+
+  // Ten times the radius needs about SQRT(10) times the segments
+  TEST_ASSERT_EQUAL(79, arc_segments_for_deviation(100, RADIANS(90), 0.005f));
+
+  // The sign of the angle doesn't matter
+  TEST_ASSERT_EQUAL(25, arc_segments_for_deviation(10, RADIANS(-90), 0.005f));
+
+  // A deviation larger than the radius needs only a chord under 180°
+  TEST_ASSERT_EQUAL(1, arc_segments_for_deviation(0.001f, RADIANS(90), 0.005f));
+  TEST_ASSERT_EQUAL(2, arc_segments_for_deviation(0.001f, RADIANS(360), 0.005f));
+}
+
+MARLIN_TEST(tessellate, arc_segments_within_deviation) {
+  const float radii[] = { 0.5f, 2, 10, 50, 250 };
+  for (const float r : radii) {
+    const uint16_t n = arc_segments_for_deviation(r, RADIANS(360), 0.005f);
+    const float sagitta = r * (1 - cos(RADIANS(360) / n / 2));
+    TEST_ASSERT_TRUE(sagitta <= 0.005f * 1.001f);
+    // One segment fewer would exceed the limit
+    if (n > 2) TEST_ASSERT_TRUE(r * (1 - cos(RADIANS(360) / (n - 1) / 2)) > 0.005f);
+  }
+}
+
+MARLIN_TEST(tessellate, bezier_straight_line) {
+  // Evenly spaced control points on a line make a straight curve
+  const BezierTessellator bez({ 0, 0 }, { 10, 5 }, { 20, 10 }, { 30, 15 });
+  TEST_ASSERT_EQUAL(1, bez.segments(0.005f, 0.002f));
+}
+
+MARLIN_TEST(tessellate, bezier_end_points) {
+  const BezierTessellator bez({ 1, 2 }, { 40, -7 }, { -12, 33 }, { 25, 9 });
+  const xy_pos_t a = bez.eval(0), b = bez.eval(1);
+  TEST_ASSERT_EQUAL_FLOAT(1, a.x);
+  TEST_ASSERT_EQUAL_FLOAT(2, a.y);
+  TEST_ASSERT_EQUAL_FLOAT(25, b.x);
+  TEST_ASSERT_EQUAL_FLOAT(9, b.y);
+}
+
+MARLIN_TEST(tessellate, bezier_within_deviation) {
+  // An S-curve with a tight bend at one end
+  const BezierTessellator bez({ 0, 0 }, { 60, 0 }, { -20, 20 }, { 40, 22 });
+  for (const float dev : { 0.002f, 0.005f, 0.05f }) {
+    for (float t = 0; t < 1;) {
+      const float t1 = bez.next(t, dev, 0.0001f);
+      TEST_ASSERT_TRUE(t1 > t);
+      TEST_ASSERT_TRUE(chord_error(bez, t, t1) <= dev * 1.001f);
+      t = t1;
+    }
+  }
+}
+
+MARLIN_TEST(tessellate, bezier_segment_counts) {
+  // Compare with the single fixed step that would meet the same limit everywhere
+  const BezierTessellator bez({ 0, 0 }, { 60, 0 }, { -20, 20 }, { 40, 22 });
+  constexpr float dev = 0.005f;
+  float max_curvature = 0;
+  for (uint8_t i = 0; i <= 100; i++) NOLESS(max_curvature, bez.curvature(i / 100.0f));
+  const uint16_t fixed = CEIL(1 / SQRT(8 * dev / max_curvature)),
+                 adaptive = bez.segments(dev, 0.0001f);
+
+  char msg[64];
+  sprintf(msg, "S-curve at 5um: %u adaptive, %u fixed-step segments", adaptive, fixed);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(adaptive < fixed);
+
+  // A tighter limit never needs fewer segments
+  TEST_ASSERT_TRUE(bez.segments(0.001f, 0.0001f) >= adaptive);
+}
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+#
+# MarlinBinaryGcode.py
+# Reference encoder and sender for BINARY_GCODE framed commands.
+#
+# G0-G3, G92, and M204 lines are sent as binary frames. All other lines are
+# sent as ASCII with line numbers and checksums, so any G-code file works.
+#
+# Usage:
+#   MarlinBinaryGcode.py <port> <baud> <file.gcode>   Print a file
+#   MarlinBinaryGcode.py --encode <file.gcode>        Write frames to stdout
+#
+import struct, binascii, sys, time
+
+SYNC = 0xF5
+FIELDS = "XYZEFIJRPST"
+COMMANDS = { ('G', 0): 0, ('G', 1): 1, ('G', 2): 2, ('G', 3): 3, ('G', 92): 4, ('M', 204): 5 }
+
+def strip_comment(line):
+    line = line.split(';', 1)[0]
+    while '(' in line and ')' in line:
+        a = line.index('('); line = line[:a] + line[line.index(')', a) + 1:]
+    return line.strip()
+
+def parse_words(line):
+    """Split a G-code line into (letter, value) pairs, or None if not numeric."""
+    words, i, line = [], 0, line.upper().replace(' ', '')
+    while i < len(line):
+        letter, j = line[i], i + 1
+        while j < len(line) and (line[j].isdigit() or line[j] in '+-.'): j += 1
+        try:
+            words.append((letter, float(line[i + 1:j]) if j > i + 1 else None))
+        except ValueError:
+            return None
+        i = j
+    return words
+
+def encode(line, n):
+    """Return the binary frame for a line, or None if it must be sent as ASCII."""
+    words = parse_words(strip_comment(line))
+    if not words or words[0][1] is None: return None
+    letter, code = words[0]
+    if code != int(code) or (letter, int(code)) not in COMMANDS: return None
+
+    mask, values = 0, {}
+    for p, v in words[1:]:
+        if p not in FIELDS or v is None or p in values: return None
+        values[p] = v
+        mask |= 1 << FIELDS.index(p)
+
+    payload = struct.pack('<HBH', n & 0xFFFF, COMMANDS[(letter, int(code))], mask)
+    payload += b''.join(struct.pack('<f', values[p]) for p in FIELDS if p in values)
+    body = bytes([len(payload)]) + payload
+    return bytes([SYNC]) + body + struct.pack('<H', binascii.crc_hqx(body, 0))
+
+def ascii_line(line, n):
+    """Return a line with its line number and checksum."""
+    cmd = "N%d %s" % (n, strip_comment(line))
+    cs = 0
+    for c in cmd: cs ^= ord(c)
+    return ("%s*%d\n" % (cmd, cs)).encode()
+
+def frame_line(line, n):
+    return encode(line, n) or ascii_line(line, n)
+
+class Sender(object):
+    """Send a G-code file, waiting for 'ok' after each line and honoring resends."""
+
+    def __init__(self, port, baud, timeout=10):
+        import serial
+        self.serial = serial.Serial(port, baud, timeout=0.1)
+        self.timeout = timeout
+        time.sleep(2)                           # Boards may reset on connect
+        self.serial.reset_input_buffer()
+
+    def readline(self):
+        end = time.time() + self.timeout
+        while time.time() < end:
+            line = self.serial.readline().decode(errors='replace').strip()
+            if line: return line
+        raise TimeoutError("No response from printer")
+
+    def command(self, data):
+        """Send one framed line. Return the line number the printer wants next."""
+        self.serial.write(data)
+        resend = None
+        while True:
+            line = self.readline()
+            if line.startswith('Resend:') or line.startswith('rs '):
+                resend = int(line.split()[-1].split(':')[-1])
+            elif line.startswith('ok'):
+                return resend
+            elif line.startswith('Error:'):
+                print(line, file=sys.stderr)
+
+    def check_capability(self):
+        self.serial.write(b"M115\n")
+        found = False
+        while True:
+            line = self.readline()
+            if line.startswith('Cap:BINARY_GCODE:'): found = line.endswith(':1')
+            if line.startswith('ok'): return found
+
+    def print_file(self, path):
+        if not self.check_capability():
+            raise RuntimeError("Printer does not report Cap:BINARY_GCODE:1")
+        lines = [l for l in (strip_comment(l) for l in open(path)) if l]
+        self.command(ascii_line("M110 N0", 0))  # Reset the line number
+        i = 0
+        while i < len(lines):
+            resend = self.command(frame_line(lines[i], i + 1))
+            i = resend - 1 if resend else i + 1
+
+if __name__ == '__main__':
+    if len(sys.argv) == 3 and sys.argv[1] == '--encode':
+        out = sys.stdout.buffer
+        n = 0
+        for l in open(sys.argv[2]):
+            l = strip_comment(l)
+            if l:
+                n += 1
+                out.write(frame_line(l, n))
+    elif len(sys.argv) == 4:
+        Sender(sys.argv[1], int(sys.argv[2])).print_file(sys.argv[3])
+    else:
+        print("Usage: MarlinBinaryGcode.py <port> <baud> <file.gcode>\n"
+              "       MarlinBinaryGcode.py --encode <file.gcode>")
+        sys.exit(1)
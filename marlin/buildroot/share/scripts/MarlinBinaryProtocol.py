@@ -60,11 +60,13 @@ class Protocol(object):
     worker_thread = None
 
     response_timeout = 1000
+    protocol_version = "0.0.0"
+    window = 1
 
     applications = []
     responses = deque()
 
-    def __init__(self, device, baud, bsize, simerr, timeout):
+    def __init__(self, device, baud, bsize, simerr, timeout, window = 8):
         print("pySerial Version:", serial.VERSION)
         self.port = serial.Serial(device, baudrate = baud, write_timeout = 0, timeout = 1)
         self.device = device
@@ -73,6 +75,7 @@ class Protocol(object):
         self.simulate_errors = max(min(simerr, 1.0), 0.0)
         self.connected = True
         self.response_timeout = timeout
+        self.window = max(int(window), 1)
 
         self.register(['ok', 'rs', 'ss', 'fe'], self.process_input)
 
@@ -146,6 +149,58 @@ class Protocol(object):
                 #print("Packetloss detected..")
         self.packet_transit = None
 
+    def send_window(self, protocol, packet_type, payloads):
+        """Send payloads with up to 'window' packets in flight (go-back-N)."""
+        if self.window < 2 or version_tuple(self.protocol_version) < (0, 2):
+            for data in payloads:
+                self.send(protocol, packet_type, data)
+            return
+
+        inflight = deque()                      # (sync, packet) awaiting 'ok', oldest first
+        pending = deque(payloads)
+        timeout = TimeOut(self.response_timeout)
+        give_up = TimeOut(self.response_timeout * 20)
+        rewound = None                          # Each gap is reported once per packet after it
+        while pending or inflight:
+            while pending and len(inflight) < self.window:
+                packet = self.build_packet(protocol, packet_type, pending.popleft())
+                inflight.append((self.sync, packet))
+                self.sync = (self.sync + 1) % 256
+                self.transmit_packet(packet)
+
+            if not len(self.responses):
+                if give_up.timedout():
+                    raise ConnectionLost()
+                if timeout.timedout():          # Packet or 'ok' lost; send the window again
+                    self.errors += 1
+                    for _, packet in inflight: self.transmit_packet(packet)
+                    rewound = None
+                    timeout.reset()
+                time.sleep(0.00001)
+                continue
+
+            token, data = self.responses.popleft()
+            try:
+                packet_id = int(data)
+            except ValueError:
+                continue
+            if token == 'ok':                   # Acknowledges everything up to packet_id
+                if any(sync == packet_id for sync, _ in inflight):
+                    while inflight.popleft()[0] != packet_id: pass
+                    rewound = None
+                    timeout.reset()
+                    give_up.reset()
+            elif token == 'rs':                 # Go back to packet_id and send from there
+                if packet_id == rewound: continue
+                self.errors += 1
+                rewound = packet_id
+                if any(sync == packet_id for sync, _ in inflight):
+                    while inflight[0][0] != packet_id: inflight.popleft()
+                    for _, packet in inflight: self.transmit_packet(packet)
+                timeout.reset()
+            elif token == 'fe':
+                raise FatalError()
+
     def await_response(self):
         timeout = TimeOut(self.response_timeout)
         while not len(self.responses):
@@ -295,6 +350,9 @@ class Protocol(object):
         raise FatalError()
 
 
+def version_tuple(version):
+    return tuple(int(v) for v in version.split('.'))
+
 class FileTransferProtocol(object):
     protocol_id = 1
 
@@ -306,6 +364,8 @@ class FileTransferProtocol(object):
         ABORT = 4
 
     responses = deque()
+    max_errors = 50     # Resends and timeouts a transfer can recover from before it gives up
+
     def __init__(self, protocol, timeout = None):
         protocol.register(['PFT:success', 'PFT:version:', 'PFT:fail', 'PFT:busy', 'PFT:ioerror', 'PTF:invalid'], self.process_input)
         self.protocol = protocol
@@ -340,8 +400,9 @@ class FileTransferProtocol(object):
 
         print("File Transfer version: {0}, compression: {1}".format(self.version, self.compression['algorithm']))
 
-    def open(self, filename, compression, dummy):
-        payload =  b'\1' if dummy else b'\0'          # dummy transfer
+    def open(self, filename, compression, dummy, resume = False):
+        """Open the file on the client. Return the offset to resume from."""
+        payload =  bytes([(1 if dummy else 0) | (2 if resume else 0)]) # dummy transfer, resume
         payload += b'\1' if compression else b'\0'    # payload compression
         payload += bytearray(filename, 'utf8') + b'\0'# target filename + null terminator
 
@@ -353,7 +414,7 @@ class FileTransferProtocol(object):
                 token, data = self.await_response(1000)
                 if token == 'PFT:success':
                     print(filename,"opened")
-                    return
+                    return int(data[1:]) if resume and data.startswith(':') else 0
                 elif token == 'PFT:busy':
                     print("Broken transfer detected, purging")
                     self.abort()
@@ -388,9 +449,13 @@ class FileTransferProtocol(object):
         if token == 'PFT:success':
             print("Transfer Aborted")
 
-    def copy(self, filename, dest_filename, compression, dummy):
+    def copy(self, filename, dest_filename, compression, dummy, resume = False):
         self.connect()
 
+        if resume and version_tuple(self.version) < (0, 2):
+            print("Resume not supported by client, starting over.")
+            resume = False
+
         has_heatshrink = heatshrink_exists and self.compression['algorithm'] == 'heatshrink'
         if compression and not has_heatshrink:
             hs = '2' if sys.version_info[0] > 2 else ''
@@ -400,7 +465,11 @@ class FileTransferProtocol(object):
         data = open(filename, "rb").read()
         filesize = len(data)
 
-        self.open(dest_filename, compression, dummy)
+        offset = self.open(dest_filename, compression, dummy, resume)
+        if offset:
+            print("Resuming after {0} bytes".format(offset))
+            data = data[offset:]
+            filesize = len(data)
 
         block_size = self.protocol.block_size
         if compression:
@@ -412,15 +481,31 @@ class FileTransferProtocol(object):
         kibs = 0
         dump_pctg = 0
         start_time = millis()
-        for i in range(blocks):
-            start = block_size * i
-            end = start + block_size
-            self.write(data[start:end])
+        burst = max(self.protocol.window, 1) * 4
+        start_errors = self.protocol.errors
+        for i in range(0, blocks, burst):
+            # Lost packets are sent again by the window. A lost connection or a fatal error raises.
+            self.protocol.send_window(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.WRITE,
+                [data[block_size * j : block_size * (j + 1)] for j in range(i, min(i + burst, blocks))])
+            i = min(i + burst, blocks) - 1
+
+            # Writes only answer when they fail
+            failed = None
+            while len(self.responses):
+                token, _ = self.responses.popleft()
+                if token in ('PFT:ioerror', 'PFT:invalid'): failed = token
+            if failed:
+                print("")
+                print("Client storage device IO error" if failed == 'PFT:ioerror' else "No open file")
+                self.abort()
+                print("Transfer failed")
+                return False
+
             kibs = (( (i+1) * block_size) / 1024) / (millis() + 1 - start_time) * 1000
             if (i / blocks) >= dump_pctg:
                 print("\r{0:2.0f}% {1:4.2f}KiB/s {2} Errors: {3}".format((i / blocks) * 100, kibs, "[{0:4.2f}KiB/s]".format(kibs * cratio) if compression else "", self.protocol.errors), end='')
                 dump_pctg += 0.1
-            if self.protocol.errors > 0:
+            if self.protocol.errors - start_errors > self.max_errors:
                 # Dump last status (errors may not be visible)
                 print("\r{0:2.0f}% {1:4.2f}KiB/s {2} Errors: {3} - Aborting...".format((i / blocks) * 100, kibs, "[{0:4.2f}KiB/s]".format(kibs * cratio) if compression else "", self.protocol.errors), end='')
                 print("")   # New line to break the transfer speed line
@@ -16,6 +16,8 @@ Options:
   --t2=ttt:rrr      middle temperature temperature:resistance point (around 150 degC)
   --t3=ttt:rrr      high temperature temperature:resistance point (around 250 degC)
   --num-temps=...   the number of temperature points to calculate (default: 36)
+  --uniform=...     also emit a table of this many evenly spaced ADC segments,
+                    in 1/16 degC, like UNIFORM_THERMISTOR_TABLES builds
 """
 
 from __future__ import print_function, division
@@ -94,9 +96,10 @@ def main(argv):
     r3 = 226.15                             # resistance at high temperature (226.15 Ohm)
     rp = 4700                               # pull-up resistor (4.7 kOhm)
     num_temps = 36                          # number of entries for look-up table
+    uniform = 0                             # segments for the uniform table (0 = none)
 
     try:
-        opts, args = getopt.getopt(argv, "h", ["help", "rp=", "t1=", "t2=", "t3=", "num-temps="])
+        opts, args = getopt.getopt(argv, "h", ["help", "rp=", "t1=", "t2=", "t3=", "num-temps=", "uniform="])
     except getopt.GetoptError as err:
         print(str(err))
         usage()
@@ -122,6 +125,8 @@ def main(argv):
             r3 = float(arg[1])
         elif opt == "--num-temps":
             num_temps = int(arg)
+        elif opt == "--uniform":
+            uniform = int(arg)
 
     t = Thermistor(rp, t1, r1, t2, r2, t3, r3)
     increment = int((ARES - 1) / (num_temps - 1))
@@ -133,7 +138,7 @@ def main(argv):
     temps = list(range(max_temp, TMIN + step, step))
 
     print("// Thermistor lookup table for Marlin")
-    print("// ./createTemperatureLookupMarlin.py --rp=%s --t1=%s:%s --t2=%s:%s --t3=%s:%s --num-temps=%s" % (rp, t1, r1, t2, r2, t3, r3, num_temps))
+    print("// ./createTemperatureLookupMarlin.py --rp=%s --t1=%s:%s --t2=%s:%s --t3=%s:%s --num-temps=%s%s" % (rp, t1, r1, t2, r2, t3, r3, num_temps, " --uniform=%s" % uniform if uniform else ""))
     print("// Steinhart-Hart Coefficients: a=%.15g, b=%.15g, c=%.15g " % (t.c1, t.c2, t.c3))
     print("// Theoretical limits of thermistor: %.2f to %.2f degC" % (low_bound, up_bound))
     print()
@@ -149,6 +154,17 @@ def main(argv):
                     ))
     print("};")
 
+    if uniform:
+        # Sample every segment boundary, clamped to the range of the table above
+        print()
+        print("// Uniform table: entry i is the temperature at ADC i * %d / %d, in 1/16 degC" % (ARES, uniform))
+        print("const short temptable_uniform[%d] PROGMEM = {" % (uniform + 1))
+        for i in range(uniform + 1):
+            adc = min(max(i * ARES / uniform, 1), ARES - 1)
+            temp = min(max(t.temp(adc), min_temp), max_temp)
+            print("    %6d%s // adc=%7.2f\t%.2f degC" % (round(temp * 16), ',' if i < uniform else ' ', adc, temp))
+        print("};")
+
 def usage():
     print(__doc__)
 
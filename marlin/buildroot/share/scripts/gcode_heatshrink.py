@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+#
+# gcode_heatshrink.py
+# Compress a G-code file for printing from SD with SD_HEATSHRINK.
+#
+# The G-code is split into blocks that are compressed one at a time, so the
+# firmware can start decompressing at any block. Each block is written as a
+# uint16 compressed size and the data. An index of the block positions goes
+# after the blocks. See Marlin/src/libs/heatshrink/heatshrink_file.h
+# for the header.
+#
+# Usage:
+#   gcode_heatshrink.py [-b <bits>] <file.gcode> [<file.gcode.hs>]
+#
+import struct, sys
+
+try:
+    import heatshrink2 as heatshrink
+except ImportError:
+    try:
+        import heatshrink
+    except ImportError:
+        heatshrink = None
+
+MAGIC = b'HSGC'
+WINDOW_BITS, LOOKAHEAD_BITS = 8, 4      # Must match HEATSHRINK_STATIC_* in the firmware
+BLOCK_BITS = 12                         # 4K blocks. Valid values are 9 to 15.
+
+def encode(data):
+    """Heatshrink-compress a block, using the heatshrink module if it's installed."""
+    if heatshrink:
+        return heatshrink.encode(data, window_sz2=WINDOW_BITS, lookahead_sz2=LOOKAHEAD_BITS)
+
+    window, longest = 1 << WINDOW_BITS, 1 << LOOKAHEAD_BITS
+    out, acc, nbits = bytearray(), 0, 0
+    def put(value, count):
+        nonlocal acc, nbits
+        acc, nbits = (acc << count) | value, nbits + count
+        while nbits >= 8:
+            nbits -= 8
+            out.append((acc >> nbits) & 0xFF)
+
+    recent, i = {}, 0    # Positions of each 2-byte sequence, newest last
+    while i < len(data):
+        best_len, best_dist = 0, 0
+        for j in reversed(recent.get(data[i:i + 2], ())):
+            if i - j > window: break
+            n = 0
+            while n < longest and i + n < len(data) and data[j + n] == data[i + n]: n += 1
+            if n > best_len:
+                best_len, best_dist = n, i - j
+                if n == longest: break
+
+        # A back-reference costs 13 bits and a literal 9, so use matches of 2 or more
+        step = best_len if best_len >= 2 else 1
+        if step > 1:
+            put(0, 1); put(best_dist - 1, WINDOW_BITS); put(best_len - 1, LOOKAHEAD_BITS)
+        else:
+            put(1, 1); put(data[i], 8)
+
+        for k in range(i, i + step):
+            recent.setdefault(data[k:k + 2], []).append(k)
+        i += step
+
+    if nbits: out.append((acc << (8 - nbits)) & 0xFF)
+    return bytes(out)
+
+def compress(data, block_bits=BLOCK_BITS):
+    block_size = 1 << block_bits
+    header_size = 16
+    blocks, index, pos = [], [], header_size
+    for start in range(0, len(data), block_size):
+        packed = encode(data[start:start + block_size])
+        index.append(pos)
+        blocks.append(struct.pack('<H', len(packed)) + packed)
+        pos += len(blocks[-1])
+
+    header = MAGIC + struct.pack('<BBBBII', WINDOW_BITS, LOOKAHEAD_BITS, block_bits, 0, len(data), pos)
+    return header + b''.join(blocks) + b''.join(struct.pack('<I', p) for p in index)
+
+def main(args):
+    block_bits = BLOCK_BITS
+    if len(args) > 1 and args[0] == '-b':
+        block_bits = int(args[1])
+        args = args[2:]
+    if not 1 <= len(args) <= 2 or not 9 <= block_bits <= 15:
+        print("Usage: gcode_heatshrink.py [-b <9-15>] <file.gcode> [<file.gcode.hs>]")
+        return 1
+
+    with open(args[0], 'rb') as f: data = f.read()
+    packed = compress(data, block_bits)
+    dest = args[1] if len(args) > 1 else args[0] + '.hs'
+    with open(dest, 'wb') as f: f.write(packed)
+    print("%s: %d -> %d bytes (%.1f:1)" % (dest, len(data), len(packed), len(data) / max(1, len(packed))))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))